@@ -44,7 +44,8 @@ struct phy_args_t {
   std::vector<uint32_t> dl_earfcn_list = {3400}; // vectorized version of dl_earfcn that gets populated during init
   std::map<uint32_t, uint32_t> ul_earfcn_map;    // Map linking DL EARFCN and UL EARFCN
 
-  int force_N_id_2 = -1; // Cell identity within the identity group (PSS) to filter.
+  int  force_N_id_2        = -1;   // Cell identity within the identity group (PSS) to filter.
+  bool cell_search_prescan = true; // Pre-scan the three PSS at once and skip the ones not present.
 
   float dl_freq = -1.0f;
   float ul_freq = -1.0f;
@@ -86,6 +87,8 @@ struct phy_args_t {
   float       estimator_fil_stddev         = 1.0f;
   uint32_t    estimator_fil_order          = 4;
   float       snr_to_cqi_offset            = 0.0f;
+  float       pdcch_prune_threshold        = 0.0f;
+  uint32_t    pdcch_prune_audit_period     = 100;
   std::string sss_algorithm                = "full";
   float       rx_gain_offset               = 62;
   bool        pdsch_csi_enabled            = true;
@@ -47,12 +47,25 @@ SRSRAN_API void srsran_sequence_state_gen_f(srsran_sequence_state_t* s, float va
 
 SRSRAN_API void srsran_sequence_state_apply_f(srsran_sequence_state_t* s, const float* in, float* out, uint32_t length);
 
+SRSRAN_API void
+srsran_sequence_state_apply_s(srsran_sequence_state_t* s, const int16_t* in, int16_t* out, uint32_t length);
+
 SRSRAN_API void
 srsran_sequence_state_apply_c(srsran_sequence_state_t* s, const int8_t* in, int8_t* out, uint32_t length);
 
 SRSRAN_API
 void srsran_sequence_state_apply_bit(srsran_sequence_state_t* s, const uint8_t* in, uint8_t* out, uint32_t length);
 
+/**
+ * @brief Applies the sequence to packed bits (MSB first) and advances the state, so consecutive calls scramble
+ * consecutive segments of the same codeword. Segments which length is a multiple of 24 bits run at full speed.
+ *
+ * @attention in and out always start at the MSB of their first byte, so every segment except the last one must be a
+ * multiple of 8 bits long. Otherwise the following call is misaligned with respect to the sequence.
+ */
+SRSRAN_API void
+srsran_sequence_state_apply_packed(srsran_sequence_state_t* s, const uint8_t* in, uint8_t* out, uint32_t length);
+
 SRSRAN_API void srsran_sequence_state_advance(srsran_sequence_state_t* s, uint32_t length);
 
 typedef struct SRSRAN_API {
@@ -94,6 +107,12 @@ SRSRAN_API int srsran_sequence_pdcch(srsran_sequence_t* seq, uint32_t nslot, uin
 SRSRAN_API int
 srsran_sequence_pdsch(srsran_sequence_t* seq, uint16_t rnti, int q, uint32_t nslot, uint32_t cell_id, uint32_t len);
 
+SRSRAN_API void srsran_sequence_pdsch_state_init(srsran_sequence_state_t* s,
+                                                 uint16_t                 rnti,
+                                                 int                      q,
+                                                 uint32_t                 nslot,
+                                                 uint32_t                 cell_id);
+
 SRSRAN_API void srsran_sequence_pdsch_apply_pack(const uint8_t* in,
                                                  uint8_t*       out,
                                                  uint16_t       rnti,
@@ -34,6 +34,8 @@
 #include "srsran/config.h"
 #include <stdbool.h>
 
+#define SRSRAN_VITERBI_MAX_BATCH 8
+
 typedef enum { SRSRAN_VITERBI_27 = 0, SRSRAN_VITERBI_29, SRSRAN_VITERBI_37, SRSRAN_VITERBI_39 } srsran_viterbi_type_t;
 
 typedef struct SRSRAN_API {
@@ -47,11 +49,19 @@ typedef struct SRSRAN_API {
   int (*decode)(void*, uint8_t*, uint8_t*, uint32_t);
   int (*decode_s)(void*, uint16_t*, uint8_t*, uint32_t);
   int (*decode_f)(void*, float*, uint8_t*, uint32_t);
+  int (*decode_batch_s)(void*, uint16_t**, uint8_t**, uint32_t, uint32_t);
   void (*free)(void*);
   uint8_t*  tmp;
   uint16_t* tmp_s;
   uint8_t*  symbols_uc;
   uint16_t* symbols_us;
+
+  // Batched decoding, one decoder state and buffers per frame. They are allocated on the first batched decode
+  int       poly[3];
+  void*     ptr_batch[SRSRAN_VITERBI_MAX_BATCH];
+  uint8_t*  tmp_batch;
+  uint16_t* tmp_s_batch;
+  uint16_t* symbols_us_batch;
 } srsran_viterbi_t;
 
 SRSRAN_API int srsran_viterbi_init(srsran_viterbi_t*     q,
@@ -74,6 +84,25 @@ SRSRAN_API int srsran_viterbi_decode_us(srsran_viterbi_t* q, uint16_t* symbols,
 
 SRSRAN_API int srsran_viterbi_decode_uc(srsran_viterbi_t* q, uint8_t* symbols, uint8_t* data, uint32_t frame_length);
 
+/**
+ * @brief Decodes several real-valued frames of the same length in one call. The decoders which support it run the
+ * trellises of the frames together, which hides the latency of the path metric updates and amortises the per call
+ * setup. Otherwise, the frames are decoded one after the other. The result is the same as calling
+ * srsran_viterbi_decode_f() for every frame.
+ *
+ * @param q Viterbi decoder object
+ * @param symbols Soft bits of every frame
+ * @param data Decoded bits of every frame
+ * @param nof_frames Number of frames, any number is accepted and processed in batches of SRSRAN_VITERBI_MAX_BATCH
+ * @param frame_length Length of every frame in bits
+ * @return SRSRAN_SUCCESS if all the frames are decoded, SRSRAN_ERROR otherwise
+ */
+SRSRAN_API int srsran_viterbi_decode_batch_f(srsran_viterbi_t* q,
+                                             float*            symbols[],
+                                             uint8_t*          data[],
+                                             uint32_t          nof_frames,
+                                             uint32_t          frame_length);
+
 SRSRAN_API int srsran_viterbi_init_sse(srsran_viterbi_t*     q,
                                        srsran_viterbi_type_t type,
                                        int                   poly[3],
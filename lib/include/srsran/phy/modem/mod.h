@@ -35,10 +35,28 @@
 
 #include "modem_table.h"
 #include "srsran/config.h"
+#include "srsran/phy/common/sequence.h"
 
 SRSRAN_API int srsran_mod_modulate(const srsran_modem_table_t* table, uint8_t* bits, cf_t* symbols, uint32_t nbits);
 
 SRSRAN_API int
 srsran_mod_modulate_bytes(const srsran_modem_table_t* q, const uint8_t* bits, cf_t* symbols, uint32_t nbits);
 
+/**
+ * @brief Scrambles and modulates packed bits in a single pass over the codeword. The bits are scrambled block by block
+ * into a small scratch buffer which is modulated straight away, the input is not modified.
+ *
+ * @param q Modem table, initialised with srsran_modem_table_bytes()
+ * @param sequence_state Scrambling sequence state, it is advanced by nbits
+ * @param bits Packed input bits, MSB first
+ * @param symbols Output modulation symbols
+ * @param nbits Number of bits, multiple of the number of bits per symbol
+ * @return The number of modulated symbols if successful, SRSRAN_ERROR code otherwise
+ */
+SRSRAN_API int srsran_mod_modulate_bytes_scrambled(const srsran_modem_table_t* q,
+                                                   srsran_sequence_state_t*    sequence_state,
+                                                   const uint8_t*              bits,
+                                                   cf_t*                       symbols,
+                                                   uint32_t                    nbits);
+
 #endif // SRSRAN_MOD_H
@@ -37,6 +37,8 @@
 #include "srsran/config.h"
 #include "srsran/phy/common/phy_common.h"
 
+#define SRSRAN_MODEM_AXIS_TABLE_SIZE 16
+
 typedef struct {
   cf_t symbol[8];
 } bpsk_packed_t;
@@ -58,6 +60,12 @@ typedef struct SRSRAN_API {
   bpsk_packed_t*  symbol_table_bpsk;
   qpsk_packed_t*  symbol_table_qpsk;
   qam16_packed_t* symbol_table_16qam;
+
+  // Per-axis amplitude tables, indexed by the even (I) and odd (Q) bits of a symbol. Only valid when the constellation
+  // is separable in I and Q, they are used as shuffle look-up tables by the SIMD mapper.
+  bool  axis_tables_init;
+  float axis_table_i[SRSRAN_MODEM_AXIS_TABLE_SIZE];
+  float axis_table_q[SRSRAN_MODEM_AXIS_TABLE_SIZE];
 } srsran_modem_table_t;
 
 SRSRAN_API void srsran_modem_table_init(srsran_modem_table_t* q);
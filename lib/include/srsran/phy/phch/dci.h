@@ -244,7 +244,7 @@ SRSRAN_API bool srsran_location_find_location(const srsran_dci_location_t* locat
 
 SRSRAN_API int srsran_dci_location_set(srsran_dci_location_t* c, uint32_t L, uint32_t nCCE);
 
-SRSRAN_API bool srsran_dci_location_isvalid(srsran_dci_location_t* c);
+SRSRAN_API bool srsran_dci_location_isvalid(const srsran_dci_location_t* c);
 
 SRSRAN_API void srsran_dci_cfg_set_common_ss(srsran_dci_cfg_t* cfg);
 
@@ -69,6 +69,10 @@ typedef struct SRSRAN_API {
   uint8_t  data[SRSRAN_BCH_PAYLOADCRC_LEN];
   uint8_t  data_enc[SRSRAN_BCH_ENCODED_LEN];
 
+  /* One buffer per source frame, all the sources of a combination are Viterbi decoded together */
+  float   rm_f_batch[4][SRSRAN_BCH_ENCODED_LEN];
+  uint8_t data_batch[4][SRSRAN_BCH_PAYLOADCRC_LEN];
+
   uint32_t frame_idx;
 
   /* tx & rx objects */
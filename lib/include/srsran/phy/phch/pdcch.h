@@ -47,6 +47,9 @@
 
 typedef enum SRSRAN_API { SEARCH_UE, SEARCH_COMMON } srsran_pdcch_search_mode_t;
 
+/* Candidates which mean absolute LLR does not exceed this value are considered empty and they are not decoded */
+#define SRSRAN_PDCCH_LLR_MEAN_MIN 0.3f
+
 /* PDCCH object */
 typedef struct SRSRAN_API {
   srsran_cell_t cell;
@@ -65,6 +68,7 @@ typedef struct SRSRAN_API {
   cf_t*    d;
   uint8_t* e;
   float    rm_f[3 * (SRSRAN_DCI_MAX_BITS + 16)];
+  float    rm_f_batch[SRSRAN_VITERBI_MAX_BATCH][3 * (SRSRAN_DCI_MAX_BITS + 16)];
   float*   llr;
 
   /* tx & rx objects */
@@ -104,6 +108,29 @@ SRSRAN_API int srsran_pdcch_extract_llr(srsran_pdcch_t*        q,
 SRSRAN_API int
 srsran_pdcch_decode_msg(srsran_pdcch_t* q, srsran_dl_sf_cfg_t* sf, srsran_dci_cfg_t* dci_cfg, srsran_dci_msg_t* msg);
 
+/**
+ * @brief Decodes a set of DCI candidates, giving the same result as calling srsran_pdcch_decode_msg() for each of them.
+ * Consecutive candidates of the same size are Viterbi decoded together, so it is best to group them by format.
+ *
+ * @return SRSRAN_SUCCESS if every candidate is valid, an error code otherwise
+ */
+SRSRAN_API int srsran_pdcch_decode_msg_batch(srsran_pdcch_t*     q,
+                                             srsran_dl_sf_cfg_t* sf,
+                                             srsran_dci_cfg_t*   dci_cfg,
+                                             srsran_dci_msg_t*   msgs[],
+                                             uint32_t            nof_msgs);
+
+/**
+ * @brief Computes the mean absolute LLR of a candidate location, which measures the energy received in its CCEs. It
+ * does not decode the candidate, so it is suitable for ranking and pruning candidates before the Viterbi decoder
+ * @param q PDCCH object, after calling srsran_pdcch_extract_llr()
+ * @param sf Subframe configuration
+ * @param location Candidate location
+ * @return The mean absolute LLR of the location, 0 if the location is not valid
+ */
+SRSRAN_API float
+srsran_pdcch_location_llr_mean(srsran_pdcch_t* q, srsran_dl_sf_cfg_t* sf, const srsran_dci_location_t* location);
+
 /**
  * @brief Computes decoded DCI correlation. It encodes the given DCI message and compares it with the received LLRs
  * @param q PDCCH object
@@ -47,6 +47,9 @@
 // Short PRACH ZC sequence sequence length
 #define SRSRAN_PRACH_N_ZC_SHORT 139
 
+// Maximum number of groups of root sequences which can be detected concurrently
+#define SRSRAN_PRACH_MAX_BATCHES 8
+
 /** Generation and detection of RACH signals for uplink.
  *  Currently only supports preamble formats 0-3.
  *  Does not currently support high speed flag.
@@ -119,6 +122,20 @@ typedef struct SRSRAN_API {
   cf_t                        sub[839 * 2];
   float                       phase[839];
 
+  // Batched detection, the roots are split in nof_batches groups which may be processed concurrently
+  bool              batch_ready;
+  uint32_t          nof_batches;
+  uint32_t          batch_root_idx[SRSRAN_PRACH_MAX_BATCHES + 1]; // First root of each group
+  srsran_dft_plan_t batch_ifft[SRSRAN_PRACH_MAX_BATCHES];       // One IFFT plan for all the roots of each group
+  cf_t*             batch_root_specs;                           // Precoded DFT of the roots, one after the other
+  cf_t*             batch_corr_spec;
+  float*            batch_corr;
+  float             batch_corr_ave[64];
+  float             batch_max_peak[64];
+  cf_t              batch_cross[64];
+  float             batch_peak_values[64][65];
+  uint32_t          batch_peak_offsets[64][65];
+
 } srsran_prach_t;
 
 typedef struct SRSRAN_API {
@@ -236,6 +253,47 @@ SRSRAN_API int srsran_prach_detect_offset(srsran_prach_t* p,
 
 SRSRAN_API void srsran_prach_set_detect_factor(srsran_prach_t* p, float factor);
 
+/**
+ * @brief Sets the number of groups in which the root sequences are split for the batched detection. Each group can be
+ * processed by a different thread with srsran_prach_detect_batch_run(). By default all the roots are in one group.
+ *
+ * @param p PRACH object
+ * @param nof_batches Number of groups, between 1 and SRSRAN_PRACH_MAX_BATCHES
+ * @return SRSRAN_SUCCESS if the number of groups is valid, SRSRAN_ERROR_INVALID_INPUTS otherwise
+ */
+SRSRAN_API int srsran_prach_set_nof_batches(srsran_prach_t* p, uint32_t nof_batches);
+
+/**
+ * @brief First step of the batched detection, transforms the received signal and extracts the PRACH bins. Neither
+ * this nor srsran_prach_detect_batch_collect() are thread-safe.
+ *
+ * srsran_prach_detect_offset() runs the three steps in a row unless the successive cancellation is enabled, which is
+ * only supported by the sequential detector.
+ *
+ * @return SRSRAN_SUCCESS or an error code
+ */
+SRSRAN_API int srsran_prach_detect_batch_prepare(srsran_prach_t* p, uint32_t freq_offset, cf_t* signal, uint32_t sig_len);
+
+/**
+ * @brief Correlates the received bins with all the roots of one group and finds their peaks. Different groups can be
+ * run concurrently, once srsran_prach_detect_batch_prepare() has returned.
+ *
+ * @return SRSRAN_SUCCESS or an error code
+ */
+SRSRAN_API int srsran_prach_detect_batch_run(srsran_prach_t* p, uint32_t batch_idx);
+
+/**
+ * @brief Last step of the batched detection, reports the detected preambles of all the groups in the same order and
+ * with the same parameters as srsran_prach_detect_offset().
+ *
+ * @return SRSRAN_SUCCESS or an error code
+ */
+SRSRAN_API int srsran_prach_detect_batch_collect(srsran_prach_t* p,
+                                                 uint32_t*       indices,
+                                                 float*          t_offsets,
+                                                 float*          peak_to_avg,
+                                                 uint32_t*       ind_len);
+
 SRSRAN_API int srsran_prach_free(srsran_prach_t* p);
 
 SRSRAN_API int srsran_prach_print_seqs(srsran_prach_t* p);
@@ -48,6 +48,16 @@
 #define SRSRAN_TX_NULL 100
 #endif
 
+/**
+ * Produces the input soft bits of a code block. It is called right before the code block is rate dematched, with the
+ * offset and number of bits of the code block within the codeword, so the bits are consumed while still in cache.
+ *
+ * Calls are made in strictly increasing offset order and their ranges never overlap. Code blocks which CRC passed in a
+ * previous transmission are skipped, so there may be a hole between the end of one range and the offset of the next
+ * one; the source must account for it (e.g. by advancing its scrambling sequence).
+ */
+typedef void (*srsran_sch_llr_source_t)(void* arg, void* e_bits, uint32_t offset, uint32_t nof_bits);
+
 /* DL-SCH AND UL-SCH common functions */
 typedef struct SRSRAN_API {
 
@@ -99,6 +109,19 @@ SRSRAN_API int srsran_dlsch_decode2(srsran_sch_t*       q,
                                     int                 codeword_idx,
                                     uint32_t            nof_layers);
 
+/**
+ * @brief Decodes a DL-SCH transport block which soft bits are produced code block by code block by llr_source, instead
+ * of being provided all at once. This allows streaming demodulation, descrambling and rate dematching per code block.
+ */
+SRSRAN_API int srsran_dlsch_decode_stream(srsran_sch_t*           q,
+                                          srsran_pdsch_cfg_t*     cfg,
+                                          srsran_sch_llr_source_t llr_source,
+                                          void*                   llr_source_arg,
+                                          int16_t*                e_bits,
+                                          uint8_t*                data,
+                                          int                     codeword_idx,
+                                          uint32_t                nof_layers);
+
 SRSRAN_API int srsran_ulsch_encode(srsran_sch_t*       q,
                                    srsran_pusch_cfg_t* cfg,
                                    uint8_t*            data,
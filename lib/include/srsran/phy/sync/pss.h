@@ -87,6 +87,7 @@ typedef struct SRSRAN_API {
   float* conv_output_abs;
   float  ema_alpha;
   float* conv_output_avg;
+  float* conv_output_avg_all[3]; // Averaged correlation of each N_id_2 for srsran_pss_find_pss_all()
   float  peak_value;
 
   bool              filter_pss_enable;
@@ -137,6 +138,8 @@ SRSRAN_API int srsran_pss_set_N_id_2(srsran_pss_t* q, uint32_t N_id_2);
 
 SRSRAN_API int srsran_pss_find_pss(srsran_pss_t* q, const cf_t* input, float* corr_peak_value);
 
+SRSRAN_API int srsran_pss_find_pss_all(srsran_pss_t* q, const cf_t* input, int peak_pos[3], float corr_peak_value[3]);
+
 SRSRAN_API int srsran_pss_chest(srsran_pss_t* q, const cf_t* input, cf_t ce[SRSRAN_PSS_LEN]);
 
 SRSRAN_API float srsran_pss_cfo_compute(srsran_pss_t* q, const cf_t* pss_recv);
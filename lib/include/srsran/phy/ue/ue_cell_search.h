@@ -51,6 +51,12 @@
 #define SRSRAN_CS_NOF_PRB      6
 #define SRSRAN_CS_SAMP_FREQ    1920000.0
 
+/* The pre-scan correlates 5 ms blocks, extended by one FFT so a PSS across the block boundary is not lost */
+#define SRSRAN_CS_PRESCAN_BLOCK_LEN (SRSRAN_SF_LEN(128) * 5)
+#define SRSRAN_CS_PRESCAN_WINDOW_LEN (SRSRAN_CS_PRESCAN_BLOCK_LEN + 128)
+#define SRSRAN_CS_PRESCAN_NOF_BLOCKS 4
+#define SRSRAN_CS_PRESCAN_DEFAULT_THRESHOLD 1.5f
+
 typedef struct SRSRAN_API {
   uint32_t cell_id;
   srsran_cp_t         cp;
@@ -74,6 +80,16 @@ typedef struct SRSRAN_API {
   uint8_t*  mode_counted;
 
   srsran_ue_cellsearch_result_t* candidates;
+
+  // Joint PSS pre-scan of the three N_id_2
+  bool              prescan_enable;
+  float             prescan_threshold;
+  srsran_pss_t      prescan_pss;
+  srsran_dft_plan_t prescan_wb_fft;
+  srsran_dft_plan_t prescan_nb_ifft;
+  cf_t*             prescan_wb_buffer;
+  cf_t*             prescan_nb_buffer;
+  uint32_t          prescan_wb_len;
 } srsran_ue_cellsearch_t;
 
 SRSRAN_API int srsran_ue_cellsearch_init(srsran_ue_cellsearch_t* q,
@@ -97,6 +113,52 @@ SRSRAN_API int srsran_ue_cellsearch_scan(srsran_ue_cellsearch_t*       q,
                                          srsran_ue_cellsearch_result_t found_cells[3],
                                          uint32_t*                     max_N_id_2);
 
+/**
+ * @brief Enables a joint pre-scan of the three N_id_2 before srsran_ue_cellsearch_scan() runs the full search for each
+ * of them. The pre-scan correlates SRSRAN_CS_PRESCAN_NOF_BLOCKS blocks of 5 ms with the three PSS at once and only the
+ * N_id_2 which peak to side-lobe ratio reaches psr_threshold are searched. An empty carrier then costs 20 ms of
+ * samples instead of three full searches.
+ *
+ * @param q Cell search object
+ * @param enable Enables the pre-scan
+ * @param psr_threshold Minimum peak to side-lobe ratio, it shall be lower than the cell search threshold
+ * @return SRSRAN_SUCCESS if the pre-scan is configured, SRSRAN_ERROR otherwise
+ */
+SRSRAN_API int srsran_ue_cellsearch_set_prescan(srsran_ue_cellsearch_t* q, bool enable, float psr_threshold);
+
+/**
+ * @brief Receives SRSRAN_CS_PRESCAN_NOF_BLOCKS blocks of 5 ms from the stream and correlates them with the three PSS
+ * at once. The stream must be sampled at SRSRAN_CS_SAMP_FREQ.
+ *
+ * @param q Cell search object with the pre-scan enabled
+ * @param psr Peak to side-lobe ratio of each N_id_2
+ * @return SRSRAN_SUCCESS or an error code
+ */
+SRSRAN_API int srsran_ue_cellsearch_prescan(srsran_ue_cellsearch_t* q, float psr[3]);
+
+/**
+ * @brief Pre-scans several carriers from a single wideband capture. The capture is transformed to the frequency
+ * domain, the bandwidth of each carrier is extracted around its offset and brought back to SRSRAN_CS_SAMP_FREQ, where
+ * the three PSS are correlated at once. Only the central 1.92 MHz of each carrier are kept, so the carriers may have any
+ * bandwidth as long as they fit in the capture.
+ *
+ * @param q Cell search object with the pre-scan enabled
+ * @param input Wideband capture, at least one 5 ms block long
+ * @param nof_samples Number of samples of the capture
+ * @param srate_hz Sampling rate of the capture, it must be a multiple of SRSRAN_CS_SAMP_FREQ
+ * @param offset_hz Centre frequency of each carrier relative to the capture centre frequency
+ * @param nof_carriers Number of carriers
+ * @param psr Peak to side-lobe ratio of each N_id_2 for each carrier
+ * @return SRSRAN_SUCCESS or an error code
+ */
+SRSRAN_API int srsran_ue_cellsearch_prescan_wideband(srsran_ue_cellsearch_t* q,
+                                                     const cf_t*             input,
+                                                     uint32_t                nof_samples,
+                                                     double                  srate_hz,
+                                                     const double*           offset_hz,
+                                                     uint32_t                nof_carriers,
+                                                     float                   psr[][3]);
+
 SRSRAN_API int srsran_ue_cellsearch_set_nof_valid_frames(srsran_ue_cellsearch_t* q, uint32_t nof_frames);
 
 SRSRAN_API void srsran_set_detect_cp(srsran_ue_cellsearch_t* q, bool enable);
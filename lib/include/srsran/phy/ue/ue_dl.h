@@ -74,6 +74,16 @@ typedef struct SRSRAN_API {
   uint32_t              nof_formats;
 } dci_blind_search_t;
 
+/* PDCCH blind search statistics, accumulated until the user resets them */
+typedef struct SRSRAN_API {
+  uint32_t nof_searches;   ///< Number of blind searches, one per search space
+  uint32_t nof_candidates; ///< Number of candidates in the search spaces, for every DCI format
+  uint32_t nof_decoded;    ///< Number of candidates that passed the pre-screening and were decoded
+  uint32_t nof_dci;        ///< Number of DCI found
+  uint32_t nof_audit_dci;  ///< Number of DCI found in audited searches
+  uint32_t nof_missed;     ///< Number of DCI found in audited searches in candidates the pre-screening discarded
+} srsran_ue_dl_pdcch_stats_t;
+
 typedef struct SRSRAN_API {
   // Cell configuration
   srsran_cell_t cell;
@@ -107,6 +117,12 @@ typedef struct SRSRAN_API {
 
   srsran_dci_location_t allocated_locations[SRSRAN_MAX_DCI_MSG];
   uint32_t              nof_allocated_locations;
+
+  // Candidates of the current blind search, decoded in one batch per format
+  srsran_dci_msg_t pdcch_candidates[SRSRAN_MAX_FORMATS][SRSRAN_MAX_CANDIDATES];
+
+  srsran_ue_dl_pdcch_stats_t pdcch_stats;
+  uint32_t                   pdcch_audit_count;
 } srsran_ue_dl_t;
 
 // Downlink config (includes common and dedicated variables)
@@ -123,6 +139,8 @@ typedef struct SRSRAN_API {
   srsran_chest_dl_cfg_t chest_cfg;
   uint32_t              last_ri;
   float                 snr_to_cqi_offset;
+  float                 pdcch_prune_threshold;    ///< Skips PDCCH candidates weaker than this ratio of the strongest one
+  uint32_t              pdcch_prune_audit_period; ///< Decodes skipped candidates every this number of searches
 } srsran_ue_dl_cfg_t;
 
 typedef struct {
@@ -99,6 +99,9 @@ void parse_args(int argc, char** argv)
 
 //#define TEST_SSE
 
+// Not a multiple of the decoder batch size, so both full and partial batches are decoded
+#define BATCH_SIZE (SRSRAN_VITERBI_MAX_BATCH + 3)
+
 int main(int argc, char** argv)
 {
   int       frame_cnt = 0;
@@ -114,6 +117,11 @@ int main(int argc, char** argv)
   int       errors_c   = 0;
   int       errors_f   = 0;
   int       errors_sse = 0;
+  int       errors_batch = 0;
+  float*    llr_batch[BATCH_SIZE];
+  uint8_t*  data_f_batch[BATCH_SIZE];
+  uint8_t*  data_rx_batch[BATCH_SIZE];
+  uint32_t  batch_cnt = 0;
 #ifdef TEST_SSE
   srsran_viterbi_t dec_sse;
 #endif
@@ -186,6 +194,16 @@ int main(int argc, char** argv)
     exit(-1);
   }
 
+  for (uint32_t b = 0; b < BATCH_SIZE; b++) {
+    llr_batch[b]     = srsran_vec_f_malloc(coded_length);
+    data_f_batch[b]  = srsran_vec_u8_malloc(frame_length);
+    data_rx_batch[b] = srsran_vec_u8_malloc(frame_length);
+    if (!llr_batch[b] || !data_f_batch[b] || !data_rx_batch[b]) {
+      perror("malloc");
+      exit(-1);
+    }
+  }
+
   float ebno_inc, esno_db;
   ebno_inc = (SNR_MAX - SNR_MIN) / SNR_POINTS;
   if (ebno_db == 100.0) {
@@ -244,6 +262,21 @@ int main(int argc, char** argv)
 #ifdef TEST_SSE
       VITERBI_TEST(srsran_viterbi_decode_uc, dec_sse, llr_c, errors_sse);
 #endif
+
+      /* The batched decoder must give exactly the same bits as the single frame float decoder */
+      srsran_vec_f_copy(llr_batch[batch_cnt], llr, coded_length);
+      memcpy(data_f_batch[batch_cnt], data_rx, frame_length);
+      batch_cnt++;
+      if (batch_cnt == BATCH_SIZE || frame_cnt + 1 == nof_frames) {
+        if (srsran_viterbi_decode_batch_f(&dec, llr_batch, data_rx_batch, batch_cnt, frame_length) < SRSRAN_SUCCESS) {
+          ERROR("Error decoding batch");
+          exit(-1);
+        }
+        for (uint32_t b = 0; b < batch_cnt; b++) {
+          errors_batch += srsran_bit_diff(data_f_batch[b], data_rx_batch[b], frame_length);
+        }
+        batch_cnt = 0;
+      }
       frame_cnt++;
       printf("     Eb/No: %3.2f %10d/%d   ", SNR_MIN + i * ebno_inc, frame_cnt, nof_frames);
       if (errors_s >= 0)
@@ -276,6 +309,11 @@ int main(int argc, char** argv)
     }
   }
   srsran_viterbi_free(&dec);
+  for (uint32_t b = 0; b < BATCH_SIZE; b++) {
+    free(llr_batch[b]);
+    free(data_f_batch[b]);
+    free(data_rx_batch[b]);
+  }
 #ifdef TEST_SSE
   srsran_viterbi_free(&dec_sse);
 #endif
@@ -302,6 +340,10 @@ int main(int argc, char** argv)
       passed &= (bool)(errors_c <= expected_e);
       passed &= (bool)(errors_f <= expected_e);
       passed &= (bool)(errors_sse <= expected_e);
+      if (errors_batch) {
+        printf("Batched decoding differs from single frame decoding in %d bits\n", errors_batch);
+        passed = false;
+      }
       exit(!passed);
     }
   } else {
@@ -156,10 +156,100 @@ int decode37_avx2_16bit(void* o, uint16_t* symbols, uint8_t* data, uint32_t fram
   return q->framebits;
 }
 
+/* Allocates the decoder states and buffers for batched decoding the first time they are needed, so the decoders which
+ * never decode in batches do not pay for them */
+static int init37_avx2_16bit_batch(srsran_viterbi_t* q)
+{
+  uint32_t stride = 3 * (q->framebits + q->K - 1);
+
+  if (!q->symbols_us_batch) {
+    q->symbols_us_batch = srsran_vec_u16_malloc(SRSRAN_VITERBI_MAX_BATCH * stride);
+  }
+  if (q->tail_biting && !q->tmp_batch) {
+    q->tmp_batch = srsran_vec_u8_malloc(SRSRAN_VITERBI_MAX_BATCH * TB_ITER * stride);
+  }
+  if (q->tail_biting && !q->tmp_s_batch) {
+    q->tmp_s_batch = srsran_vec_u16_malloc(SRSRAN_VITERBI_MAX_BATCH * TB_ITER * stride);
+  }
+  if (!q->symbols_us_batch || (q->tail_biting && (!q->tmp_batch || !q->tmp_s_batch))) {
+    perror("malloc");
+    return -1;
+  }
+
+  for (uint32_t i = 0; i < SRSRAN_VITERBI_MAX_BATCH; i++) {
+    if (!q->ptr_batch[i] && (q->ptr_batch[i] = create_viterbi37_avx2_16bit(q->poly, TB_ITER * q->framebits)) == NULL) {
+      ERROR("create_viterbi37 failed");
+      return -1;
+    }
+  }
+  return 0;
+}
+
+int decode37_avx2_16bit_batch(void* o, uint16_t** symbols, uint8_t** data, uint32_t nof_frames, uint32_t frame_length)
+{
+  srsran_viterbi_t* q = o;
+
+  uint32_t  best_state[SRSRAN_VITERBI_MAX_BATCH];
+  uint16_t* syms[SRSRAN_VITERBI_MAX_BATCH];
+  uint32_t  stride = 3 * (q->framebits + q->K - 1);
+
+  if (frame_length > q->framebits || nof_frames > SRSRAN_VITERBI_MAX_BATCH) {
+    fprintf(stderr, "Initialized decoder for max frame length %d bits\n", q->framebits);
+    return -1;
+  }
+
+  if (q->ptr_batch[SRSRAN_VITERBI_MAX_BATCH - 1] == NULL && init37_avx2_16bit_batch(q) < 0) {
+    return -1;
+  }
+
+  /* Initialize Viterbi decoders */
+  for (uint32_t f = 0; f < nof_frames; f++) {
+    init_viterbi37_avx2_16bit(q->ptr_batch[f], q->tail_biting ? -1 : 0);
+  }
+
+  /* Decode block */
+  if (q->tail_biting) {
+    for (uint32_t f = 0; f < nof_frames; f++) {
+      syms[f] = &q->tmp_s_batch[f * TB_ITER * stride];
+      for (int i = 0; i < TB_ITER; i++) {
+        memcpy(&syms[f][i * 3 * frame_length], symbols[f], 3 * frame_length * sizeof(uint16_t));
+      }
+    }
+    update_viterbi37_blk_avx2_16bit_batch(q->ptr_batch, syms, nof_frames, TB_ITER * frame_length, best_state);
+    for (uint32_t f = 0; f < nof_frames; f++) {
+      uint8_t* tmp = &q->tmp_batch[f * TB_ITER * stride];
+      chainback_viterbi37_avx2_16bit(q->ptr_batch[f], tmp, TB_ITER * frame_length, best_state[f]);
+      memcpy(data[f], &tmp[((int)(TB_ITER / 2)) * frame_length], frame_length * sizeof(uint8_t));
+    }
+  } else {
+    update_viterbi37_blk_avx2_16bit_batch(q->ptr_batch, symbols, nof_frames, frame_length + q->K - 1, NULL);
+    for (uint32_t f = 0; f < nof_frames; f++) {
+      chainback_viterbi37_avx2_16bit(q->ptr_batch[f], data[f], frame_length, 0);
+    }
+  }
+
+  return q->framebits;
+}
+
 void free37_avx2_16bit(void* o)
 {
   srsran_viterbi_t* q = o;
 
+  for (uint32_t i = 0; i < SRSRAN_VITERBI_MAX_BATCH; i++) {
+    if (q->ptr_batch[i]) {
+      delete_viterbi37_avx2_16bit(q->ptr_batch[i]);
+    }
+  }
+  if (q->symbols_us_batch) {
+    free(q->symbols_us_batch);
+  }
+  if (q->tmp_batch) {
+    free(q->tmp_batch);
+  }
+  if (q->tmp_s_batch) {
+    free(q->tmp_s_batch);
+  }
+
   if (q->symbols_uc) {
     free(q->symbols_uc);
   }
@@ -439,8 +529,10 @@ int init37_avx2_16bit(srsran_viterbi_t* q, int poly[3], uint32_t framebits, bool
   q->gain_quant_s = 4;
   q->gain_quant   = DEFAULT_GAIN_16;
   q->tail_biting  = tail_biting;
-  q->decode_s     = decode37_avx2_16bit;
-  q->free         = free37_avx2_16bit;
+  memcpy(q->poly, poly, sizeof(q->poly));
+  q->decode_s       = decode37_avx2_16bit;
+  q->decode_batch_s = decode37_avx2_16bit_batch;
+  q->free           = free37_avx2_16bit;
   q->decode_f     = NULL;
   q->symbols_uc   = srsran_vec_u8_malloc(3 * (q->framebits + q->K - 1));
   q->symbols_us   = srsran_vec_u16_malloc(3 * (q->framebits + q->K - 1));
@@ -521,6 +613,7 @@ int srsran_viterbi_init_sse(srsran_viterbi_t*     q,
                             uint32_t              max_frame_length,
                             bool                  tail_bitting)
 {
+  bzero(q, sizeof(srsran_viterbi_t));
   return init37_sse(q, poly, max_frame_length, tail_bitting);
 }
 #endif
@@ -532,6 +625,7 @@ int srsran_viterbi_init_avx2(srsran_viterbi_t*     q,
                              uint32_t              max_frame_length,
                              bool                  tail_bitting)
 {
+  bzero(q, sizeof(srsran_viterbi_t));
   return init37_avx2(q, poly, max_frame_length, tail_bitting);
 }
 #endif
@@ -544,6 +638,19 @@ void srsran_viterbi_free(srsran_viterbi_t* q)
   bzero(q, sizeof(srsran_viterbi_t));
 }
 
+#ifdef VITERBI_16
+/* Normalises real-valued symbols to the gain of the decoder and quantizes them to unsigned 16 bit */
+static void viterbi_quant_f_us(srsran_viterbi_t* q, const float* symbols, uint16_t* symbols_us, uint32_t len)
+{
+  float    max   = 1e-9;
+  uint32_t max_i = srsran_vec_max_abs_fi(symbols, len);
+  if (max_i < len && isnormal(symbols[max_i])) {
+    max = fabsf(symbols[max_i]);
+  }
+  srsran_vec_quant_fus(symbols, symbols_us, q->gain_quant / max, 32767.5, 65535, len);
+}
+#endif
+
 /* symbols are real-valued */
 int srsran_viterbi_decode_f(srsran_viterbi_t* q, float* symbols, uint8_t* data, uint32_t frame_length)
 {
@@ -558,15 +665,15 @@ int srsran_viterbi_decode_f(srsran_viterbi_t* q, float* symbols, uint8_t* data,
     len = 3 * (frame_length + q->K - 1);
   }
   if (!q->decode_f) {
+#ifdef VITERBI_16
+    viterbi_quant_f_us(q, symbols, q->symbols_us, len);
+    return srsran_viterbi_decode_us(q, q->symbols_us, data, frame_length);
+#else
     float    max   = 1e-9;
     uint32_t max_i = srsran_vec_max_abs_fi(symbols, len);
     if (max_i < len && isnormal(symbols[max_i])) {
       max = fabsf(symbols[max_i]);
     }
-#ifdef VITERBI_16
-    srsran_vec_quant_fus(symbols, q->symbols_us, q->gain_quant / max, 32767.5, 65535, len);
-    return srsran_viterbi_decode_us(q, q->symbols_us, data, frame_length);
-#else
     srsran_vec_quant_fuc(symbols, q->symbols_uc, q->gain_quant / max, 127.5, 255, len);
     return srsran_viterbi_decode_uc(q, q->symbols_uc, data, frame_length);
 #endif
@@ -625,3 +732,52 @@ int srsran_viterbi_decode_uc(srsran_viterbi_t* q, uint8_t* symbols, uint8_t* dat
 
   return ret;
 }
+
+int srsran_viterbi_decode_batch_f(srsran_viterbi_t* q,
+                                  float*            symbols[],
+                                  uint8_t*          data[],
+                                  uint32_t          nof_frames,
+                                  uint32_t          frame_length)
+{
+  if (q == NULL || symbols == NULL || data == NULL) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  if (frame_length > q->framebits) {
+    ERROR("Initialized decoder for max frame length %d bits", q->framebits);
+    return SRSRAN_ERROR;
+  }
+
+  for (uint32_t i = 0; i < nof_frames; i += SRSRAN_VITERBI_MAX_BATCH) {
+    uint32_t nof_batch = SRSRAN_MIN(nof_frames - i, SRSRAN_VITERBI_MAX_BATCH);
+
+#ifdef VITERBI_16
+    if (q->decode_batch_s && !q->decode_f) {
+      uint32_t  len    = q->tail_biting ? 3 * frame_length : 3 * (frame_length + q->K - 1);
+      uint32_t  stride = 3 * (q->framebits + q->K - 1);
+      uint16_t* symbols_us[SRSRAN_VITERBI_MAX_BATCH];
+
+      if (q->symbols_us_batch == NULL && init37_avx2_16bit_batch(q) < 0) {
+        return SRSRAN_ERROR;
+      }
+
+      for (uint32_t f = 0; f < nof_batch; f++) {
+        symbols_us[f] = &q->symbols_us_batch[f * stride];
+        viterbi_quant_f_us(q, symbols[i + f], symbols_us[f], len);
+      }
+      if (q->decode_batch_s(q, symbols_us, &data[i], nof_batch, frame_length) < 0) {
+        return SRSRAN_ERROR;
+      }
+      continue;
+    }
+#endif /* VITERBI_16 */
+
+    for (uint32_t f = 0; f < nof_batch; f++) {
+      if (srsran_viterbi_decode_f(q, symbols[i + f], data[i + f], frame_length) < 0) {
+        return SRSRAN_ERROR;
+      }
+    }
+  }
+
+  return SRSRAN_SUCCESS;
+}
@@ -82,4 +82,10 @@ void delete_viterbi37_avx2_16bit(void* p);
 
 int update_viterbi37_blk_avx2_16bit(void* p, uint16_t* syms, uint32_t nbits, uint32_t* best_state);
 
+void update_viterbi37_blk_avx2_16bit_batch(void*     p[],
+                                           uint16_t* syms[],
+                                           uint32_t  nof_frames,
+                                           int       nbits,
+                                           uint32_t  best_state[]);
+
 #endif /* SRSRAN_VITERBI37_H_ */
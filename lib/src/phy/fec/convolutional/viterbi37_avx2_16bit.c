@@ -196,149 +196,155 @@ inline unsigned short my_mm256_movemask_epi16(__m256i x)
   return (tmp);
 }
 
-void update_viterbi37_blk_avx2_16bit(void* p, unsigned short* syms, int nbits, uint32_t* best_state)
+/* Processes one trellis stage: updates the path metrics and stores the decisions in d */
+static inline void update_viterbi37_stage_avx2_16bit(struct v37* vp, decision_t* d, const unsigned short* syms)
 {
-  struct v37* vp = p;
-  decision_t* d;
+  __m256i sym0v, sym1v, sym2v;
+  void*   tmp;
+  int     i;
 
-  if (p == NULL)
-    return;
+  /* Splat the 0th symbol across sym0v, the 1st symbol across sym1v, etc */
+
+  sym0v = _mm256_set1_epi16(syms[0]);
+  sym1v = _mm256_set1_epi16(syms[1]);
+  sym2v = _mm256_set1_epi16(syms[2]);
+
+  for (i = 0; i < 2; i++) {
+
+    __m256i decision0, decision1, metric, m_metric, m0, m1, m2, m3, survivor0, survivor1;
+
+    /* Form branch metrics */
+    m0     = _mm256_avg_epu16(_mm256_xor_si256(Branchtab37_sse2[0].v[i], sym0v),
+                          _mm256_xor_si256(Branchtab37_sse2[1].v[i], sym1v));
+    metric = _mm256_avg_epu16(_mm256_xor_si256(Branchtab37_sse2[2].v[i], sym2v), m0);
 
 #ifdef DEBUG
-  printf("[");
+    print_128i("metric_initial", metric);
 #endif
+    /* There's no packed bytes right shift in SSE2, so we use the word version and mask
+     */
 
-  d = (decision_t*)vp->dp;
+    metric   = _mm256_srli_epi16(metric, 3);
+    m_metric = _mm256_sub_epi16(_mm256_set1_epi16(8191), metric);
 
-  for (int s = 0; s < nbits; s++) {
-    memset(d + s, 0, sizeof(decision_t));
-  }
+#ifdef DEBUG
+    print_128i("metric        ", metric);
+    print_128i("m_metric      ", m_metric);
+#endif
 
-  while (nbits--) {
-    __m256i sym0v, sym1v, sym2v;
-    void*   tmp;
-    int     i;
+    /* Add branch metrics to path metrics */
 
-    // printf("nbits=%d, syms=%d,%d,%d\n", nbits, syms[0], syms[1], syms[2]);fflush(stdout);
+    m0 = _mm256_add_epi16(vp->old_metrics->v[i], metric);
+    m3 = _mm256_add_epi16(vp->old_metrics->v[2 + i], metric);
+    m1 = _mm256_add_epi16(vp->old_metrics->v[2 + i], m_metric);
+    m2 = _mm256_add_epi16(vp->old_metrics->v[i], m_metric);
 
-    /* Splat the 0th symbol across sym0v, the 1st symbol across sym1v, etc */
+    /* Compare and select, using modulo arithmetic */
 
-    sym0v = _mm256_set1_epi16(syms[0]);
-    sym1v = _mm256_set1_epi16(syms[1]);
-    sym2v = _mm256_set1_epi16(syms[2]);
+    decision0 = _mm256_cmpgt_epi16(_mm256_sub_epi16(m0, m1), _mm256_setzero_si256());
+    decision1 = _mm256_cmpgt_epi16(_mm256_sub_epi16(m2, m3), _mm256_setzero_si256());
+    survivor0 = _mm256_or_si256(_mm256_and_si256(decision0, m1), _mm256_andnot_si256(decision0, m0));
+    survivor1 = _mm256_or_si256(_mm256_and_si256(decision1, m3), _mm256_andnot_si256(decision1, m2));
 
-    syms += 3;
+    /* Pack each set of decisions into 16 bits */
 
-    for (i = 0; i < 2; i++) {
+    decision0 = _mm256_permute4x64_epi64(decision0, 216);
+    decision1 = _mm256_permute4x64_epi64(decision1, 216);
 
-      __m256i decision0, decision1, metric, m_metric, m0, m1, m2, m3, survivor0, survivor1;
+    __m256i packed = _mm256_packus_epi16(_mm256_srli_epi16(_mm256_unpacklo_epi16(decision0, decision1), 8),
+                                         _mm256_srli_epi16(_mm256_unpackhi_epi16(decision0, decision1), 8));
 
-      /* Form branch metrics */
-      m0     = _mm256_avg_epu16(_mm256_xor_si256(Branchtab37_sse2[0].v[i], sym0v),
-                            _mm256_xor_si256(Branchtab37_sse2[1].v[i], sym1v));
-      metric = _mm256_avg_epu16(_mm256_xor_si256(Branchtab37_sse2[2].v[i], sym2v), m0);
+    d->w[i] = _mm256_movemask_epi8(packed);
 
-#ifdef DEBUG
-      print_128i("metric_initial", metric);
-#endif
-      /* There's no packed bytes right shift in SSE2, so we use the word version and mask
-       */
+    unsigned char temp_char1 = d->c[4 * i + 1];
+    unsigned char temp_char2 = d->c[4 * i + 2];
 
-      metric   = _mm256_srli_epi16(metric, 3);
-      m_metric = _mm256_sub_epi16(_mm256_set1_epi16(8191), metric);
+    d->c[4 * i + 1] = temp_char2;
+    d->c[4 * i + 2] = temp_char1;
 
-#ifdef DEBUG
-      print_128i("metric        ", metric);
-      print_128i("m_metric      ", m_metric);
-#endif
+    /* Store surviving metrics */
+    survivor0 = _mm256_permute4x64_epi64(survivor0, 216);
+    survivor1 = _mm256_permute4x64_epi64(survivor1, 216);
 
-      /* Add branch metrics to path metrics */
+    vp->new_metrics->v[2 * i]     = _mm256_unpacklo_epi16(survivor0, survivor1);
+    vp->new_metrics->v[2 * i + 1] = _mm256_unpackhi_epi16(survivor0, survivor1);
+  }
 
-      m0 = _mm256_add_epi16(vp->old_metrics->v[i], metric);
-      m3 = _mm256_add_epi16(vp->old_metrics->v[2 + i], metric);
-      m1 = _mm256_add_epi16(vp->old_metrics->v[2 + i], m_metric);
-      m2 = _mm256_add_epi16(vp->old_metrics->v[i], m_metric);
+  // See if we need to normalize
+  if (vp->new_metrics->c[0] > 12288) {
+    uint16_t adjust;
+    __m256i  adjustv;
+    union {
+      __m256i      v;
+      signed short w[8];
+    } t;
+
+    adjustv = vp->new_metrics->v[0];
+    for (i = 1; i < 4; i++) {
+      adjustv = _mm256_min_epu16(adjustv, vp->new_metrics->v[i]);
+    }
 
-      /* Compare and select, using modulo arithmetic */
+    adjustv = _mm256_min_epu16(adjustv, _mm256_srli_si256(adjustv, 16));
+    adjustv = _mm256_min_epu16(adjustv, _mm256_srli_si256(adjustv, 8));
+    adjustv = _mm256_min_epu16(adjustv, _mm256_srli_si256(adjustv, 4));
 
-      decision0 = _mm256_cmpgt_epi16(_mm256_sub_epi16(m0, m1), _mm256_setzero_si256());
-      decision1 = _mm256_cmpgt_epi16(_mm256_sub_epi16(m2, m3), _mm256_setzero_si256());
-      survivor0 = _mm256_or_si256(_mm256_and_si256(decision0, m1), _mm256_andnot_si256(decision0, m0));
-      survivor1 = _mm256_or_si256(_mm256_and_si256(decision1, m3), _mm256_andnot_si256(decision1, m2));
+    t.v     = adjustv;
+    adjust  = t.w[0];
+    adjustv = _mm256_set1_epi16(adjust);
 
-      /* Pack each set of decisions into 16 bits */
+    /* We cannot use a saturated subtract, because we often have to adjust by more than SHRT_MAX
+     * This is okay since it can't overflow anyway
+     */
+    for (i = 0; i < 4; i++)
+      vp->new_metrics->v[i] = _mm256_sub_epi16(vp->new_metrics->v[i], adjustv);
+  }
 
-      decision0 = _mm256_permute4x64_epi64(decision0, 216);
-      decision1 = _mm256_permute4x64_epi64(decision1, 216);
+  /* Swap pointers to old and new metrics */
+  tmp             = vp->old_metrics;
+  vp->old_metrics = vp->new_metrics;
+  vp->new_metrics = tmp;
+}
 
-      __m256i packed = _mm256_packus_epi16(_mm256_srli_epi16(_mm256_unpacklo_epi16(decision0, decision1), 8),
-                                           _mm256_srli_epi16(_mm256_unpackhi_epi16(decision0, decision1), 8));
+static uint32_t best_state_viterbi37_avx2_16bit(struct v37* vp)
+{
+  uint32_t i, bst = 0;
 
-      d->w[i] = _mm256_movemask_epi8(packed);
+  uint16_t minmetric = UINT16_MAX;
+  for (i = 0; i < 64; i++) {
+    if (vp->old_metrics->c[i] <= minmetric) {
+      bst       = i;
+      minmetric = vp->old_metrics->c[i];
+    }
+  }
+  return bst;
+}
 
-      unsigned char temp_char1 = d->c[4 * i + 1];
-      unsigned char temp_char2 = d->c[4 * i + 2];
+void update_viterbi37_blk_avx2_16bit(void* p, unsigned short* syms, int nbits, uint32_t* best_state)
+{
+  struct v37* vp = p;
+  decision_t* d;
 
-      d->c[4 * i + 1] = temp_char2;
-      d->c[4 * i + 2] = temp_char1;
+  if (p == NULL)
+    return;
 
-      /* Store surviving metrics */
-      survivor0 = _mm256_permute4x64_epi64(survivor0, 216);
-      survivor1 = _mm256_permute4x64_epi64(survivor1, 216);
+#ifdef DEBUG
+  printf("[");
+#endif
 
-      vp->new_metrics->v[2 * i]     = _mm256_unpacklo_epi16(survivor0, survivor1);
-      vp->new_metrics->v[2 * i + 1] = _mm256_unpackhi_epi16(survivor0, survivor1);
-    }
+  d = (decision_t*)vp->dp;
 
-    // See if we need to normalize
-    if (vp->new_metrics->c[0] > 12288) {
-      int i;
-
-      uint16_t adjust;
-      __m256i  adjustv;
-      union {
-        __m256i      v;
-        signed short w[8];
-      } t;
-
-      adjustv = vp->new_metrics->v[0];
-      for (i = 1; i < 4; i++) {
-        adjustv = _mm256_min_epu16(adjustv, vp->new_metrics->v[i]);
-      }
-
-      adjustv = _mm256_min_epu16(adjustv, _mm256_srli_si256(adjustv, 16));
-      adjustv = _mm256_min_epu16(adjustv, _mm256_srli_si256(adjustv, 8));
-      adjustv = _mm256_min_epu16(adjustv, _mm256_srli_si256(adjustv, 4));
-
-      t.v     = adjustv;
-      adjust  = t.w[0];
-      adjustv = _mm256_set1_epi16(adjust);
-
-      /* We cannot use a saturated subtract, because we often have to adjust by more than SHRT_MAX
-       * This is okay since it can't overflow anyway
-       */
-      for (i = 0; i < 4; i++)
-        vp->new_metrics->v[i] = _mm256_sub_epi16(vp->new_metrics->v[i], adjustv);
-    }
+  for (int s = 0; s < nbits; s++) {
+    memset(d + s, 0, sizeof(decision_t));
+  }
 
+  while (nbits--) {
+    update_viterbi37_stage_avx2_16bit(vp, d, syms);
+    syms += 3;
     d++;
-    /* Swap pointers to old and new metrics */
-    tmp             = vp->old_metrics;
-    vp->old_metrics = vp->new_metrics;
-    vp->new_metrics = tmp;
   }
 
   if (best_state) {
-    uint32_t i, bst = 0;
-
-    uint16_t minmetric = UINT16_MAX;
-    for (i = 0; i < 64; i++) {
-      if (vp->old_metrics->c[i] <= minmetric) {
-        bst       = i;
-        minmetric = vp->old_metrics->c[i];
-      }
-    }
-    *best_state = bst;
+    *best_state = best_state_viterbi37_avx2_16bit(vp);
   }
 
 #ifdef DEBUG
@@ -348,4 +354,32 @@ void update_viterbi37_blk_avx2_16bit(void* p, unsigned short* syms, int nbits, u
   vp->dp = d;
 }
 
+/* Runs several independent trellises of the same length stage by stage. The path metrics update of one frame does not
+ * depend on the others, so the CPU overlaps their compare-select chains instead of waiting on a single one */
+void update_viterbi37_blk_avx2_16bit_batch(void*           p[],
+                                           unsigned short* syms[],
+                                           uint32_t        nof_frames,
+                                           int             nbits,
+                                           uint32_t        best_state[])
+{
+  for (uint32_t f = 0; f < nof_frames; f++) {
+    struct v37* vp = p[f];
+    memset(vp->dp, 0, sizeof(decision_t) * nbits);
+  }
+
+  for (int s = 0; s < nbits; s++) {
+    for (uint32_t f = 0; f < nof_frames; f++) {
+      struct v37* vp = p[f];
+      update_viterbi37_stage_avx2_16bit(vp, vp->dp, &syms[f][3 * s]);
+      vp->dp++;
+    }
+  }
+
+  if (best_state) {
+    for (uint32_t f = 0; f < nof_frames; f++) {
+      best_state[f] = best_state_viterbi37_avx2_16bit(p[f]);
+    }
+  }
+}
+
 #endif
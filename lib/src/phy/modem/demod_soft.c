@@ -264,9 +264,9 @@ void demod_16qam_lte_s_sse(const cf_t* symbols, short* llr, int nsymbols)
   __m128i shuffle_abs_2 = _mm_set_epi8(15, 14, 13, 12, 0xff, 0xff, 0xff, 0xff, 11, 10, 9, 8, 0xff, 0xff, 0xff, 0xff);
 
   for (int i = 0; i < nsymbols / 4; i++) {
-    symbol1 = _mm_load_ps(symbolsPtr);
+    symbol1 = _mm_loadu_ps(symbolsPtr);
     symbolsPtr += 4;
-    symbol2 = _mm_load_ps(symbolsPtr);
+    symbol2 = _mm_loadu_ps(symbolsPtr);
     symbolsPtr += 4;
     symbol_i1 = _mm_cvtps_epi32(_mm_mul_ps(symbol1, scale_v));
     symbol_i2 = _mm_cvtps_epi32(_mm_mul_ps(symbol2, scale_v));
@@ -281,9 +281,9 @@ void demod_16qam_lte_s_sse(const cf_t* symbols, short* llr, int nsymbols)
     result21 = _mm_shuffle_epi8(symbol_i, shuffle_negated_2);
     result22 = _mm_shuffle_epi8(symbol_abs, shuffle_abs_2);
 
-    _mm_store_si128(resultPtr, _mm_or_si128(result11, result12));
+    _mm_storeu_si128(resultPtr, _mm_or_si128(result11, result12));
     resultPtr++;
-    _mm_store_si128(resultPtr, _mm_or_si128(result21, result22));
+    _mm_storeu_si128(resultPtr, _mm_or_si128(result21, result22));
     resultPtr++;
   }
   // Demodulate last symbols
@@ -316,13 +316,13 @@ void demod_16qam_lte_b_sse(const cf_t* symbols, int8_t* llr, int nsymbols)
   __m128i shuffle_abs_2 = _mm_set_epi8(15, 14, 0xff, 0xff, 13, 12, 0xff, 0xff, 11, 10, 0xff, 0xff, 9, 8, 0xff, 0xff);
 
   for (int i = 0; i < nsymbols / 8; i++) {
-    symbol1 = _mm_load_ps(symbolsPtr);
+    symbol1 = _mm_loadu_ps(symbolsPtr);
     symbolsPtr += 4;
-    symbol2 = _mm_load_ps(symbolsPtr);
+    symbol2 = _mm_loadu_ps(symbolsPtr);
     symbolsPtr += 4;
-    symbol3 = _mm_load_ps(symbolsPtr);
+    symbol3 = _mm_loadu_ps(symbolsPtr);
     symbolsPtr += 4;
-    symbol4 = _mm_load_ps(symbolsPtr);
+    symbol4 = _mm_loadu_ps(symbolsPtr);
     symbolsPtr += 4;
     symbol_i1 = _mm_cvtps_epi32(_mm_mul_ps(symbol1, scale_v));
     symbol_i2 = _mm_cvtps_epi32(_mm_mul_ps(symbol2, scale_v));
@@ -341,9 +341,9 @@ void demod_16qam_lte_b_sse(const cf_t* symbols, int8_t* llr, int nsymbols)
     result2n = _mm_shuffle_epi8(symbol_i, shuffle_negated_2);
     result2a = _mm_shuffle_epi8(symbol_abs, shuffle_abs_2);
 
-    _mm_store_si128(resultPtr, _mm_or_si128(result1n, result1a));
+    _mm_storeu_si128(resultPtr, _mm_or_si128(result1n, result1a));
     resultPtr++;
-    _mm_store_si128(resultPtr, _mm_or_si128(result2n, result2a));
+    _mm_storeu_si128(resultPtr, _mm_or_si128(result2n, result2a));
     resultPtr++;
   }
   // Demodulate last symbols
@@ -596,9 +596,9 @@ static void demod_64qam_lte_s_sse(const cf_t* symbols, int16_t* llr, int nsymbol
   __m128i shuffle_abs2_3 = _mm_set_epi8(15, 14, 13, 12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 11, 10, 9, 8);
 
   for (int i = 0; i < nsymbols / 4; i++) {
-    symbol1 = _mm_load_ps(symbolsPtr);
+    symbol1 = _mm_loadu_ps(symbolsPtr);
     symbolsPtr += 4;
-    symbol2 = _mm_load_ps(symbolsPtr);
+    symbol2 = _mm_loadu_ps(symbolsPtr);
     symbolsPtr += 4;
     symbol_i1 = _mm_cvtps_epi32(_mm_mul_ps(symbol1, scale_v));
     symbol_i2 = _mm_cvtps_epi32(_mm_mul_ps(symbol2, scale_v));
@@ -620,11 +620,11 @@ static void demod_64qam_lte_s_sse(const cf_t* symbols, int16_t* llr, int nsymbol
     result32 = _mm_shuffle_epi8(symbol_abs, shuffle_abs_3);
     result33 = _mm_shuffle_epi8(symbol_abs2, shuffle_abs2_3);
 
-    _mm_store_si128(resultPtr, _mm_or_si128(_mm_or_si128(result11, result12), result13));
+    _mm_storeu_si128(resultPtr, _mm_or_si128(_mm_or_si128(result11, result12), result13));
     resultPtr++;
-    _mm_store_si128(resultPtr, _mm_or_si128(_mm_or_si128(result21, result22), result23));
+    _mm_storeu_si128(resultPtr, _mm_or_si128(_mm_or_si128(result21, result22), result23));
     resultPtr++;
-    _mm_store_si128(resultPtr, _mm_or_si128(_mm_or_si128(result31, result32), result33));
+    _mm_storeu_si128(resultPtr, _mm_or_si128(_mm_or_si128(result31, result32), result33));
     resultPtr++;
   }
 
@@ -674,13 +674,13 @@ void demod_64qam_lte_b_sse(const cf_t* symbols, int8_t* llr, int nsymbols)
       _mm_set_epi8(15, 14, 0xff, 0xff, 0xff, 0xff, 13, 12, 0xff, 0xff, 0xff, 0xff, 11, 10, 0xff, 0xff);
 
   for (int i = 0; i < nsymbols / 8; i++) {
-    symbol1 = _mm_load_ps(symbolsPtr);
+    symbol1 = _mm_loadu_ps(symbolsPtr);
     symbolsPtr += 4;
-    symbol2 = _mm_load_ps(symbolsPtr);
+    symbol2 = _mm_loadu_ps(symbolsPtr);
     symbolsPtr += 4;
-    symbol3 = _mm_load_ps(symbolsPtr);
+    symbol3 = _mm_loadu_ps(symbolsPtr);
     symbolsPtr += 4;
-    symbol4 = _mm_load_ps(symbolsPtr);
+    symbol4 = _mm_loadu_ps(symbolsPtr);
     symbolsPtr += 4;
     symbol_i1 = _mm_cvtps_epi32(_mm_mul_ps(symbol1, scale_v));
     symbol_i2 = _mm_cvtps_epi32(_mm_mul_ps(symbol2, scale_v));
@@ -706,11 +706,11 @@ void demod_64qam_lte_b_sse(const cf_t* symbols, int8_t* llr, int nsymbols)
     result32 = _mm_shuffle_epi8(symbol_abs, shuffle_abs_3);
     result33 = _mm_shuffle_epi8(symbol_abs2, shuffle_abs2_3);
 
-    _mm_store_si128(resultPtr, _mm_or_si128(_mm_or_si128(result11, result12), result13));
+    _mm_storeu_si128(resultPtr, _mm_or_si128(_mm_or_si128(result11, result12), result13));
     resultPtr++;
-    _mm_store_si128(resultPtr, _mm_or_si128(_mm_or_si128(result21, result22), result23));
+    _mm_storeu_si128(resultPtr, _mm_or_si128(_mm_or_si128(result21, result22), result23));
     resultPtr++;
-    _mm_store_si128(resultPtr, _mm_or_si128(_mm_or_si128(result31, result32), result33));
+    _mm_storeu_si128(resultPtr, _mm_or_si128(_mm_or_si128(result31, result32), result33));
     resultPtr++;
   }
 
@@ -27,6 +27,18 @@
 #include "srsran/phy/modem/mod.h"
 #include "srsran/phy/utils/bit.h"
 #include "srsran/phy/utils/debug.h"
+#include "srsran/phy/utils/vector.h"
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#endif /* LV_HAVE_AVX2 */
+
+/**
+ * Number of packed bytes scrambled into the stack scratch buffer by srsran_mod_modulate_bytes_scrambled() at a time. It
+ * must be a multiple of 3 bytes (one parallel step of the sequence generator) and its number of bits a multiple of any
+ * number of bits per symbol.
+ */
+#define MOD_SCRAMBLING_BLOCK_BYTES 192
 
 /** Low-level API */
 
@@ -131,6 +143,79 @@ static void mod_256qam_bytes(const srsran_modem_table_t* q, const uint8_t* bits,
   }
 }
 
+#ifdef LV_HAVE_AVX2
+/*
+ * Maps 8 symbols per iteration using the per-axis tables as shuffle look-up tables. The packed bits of every symbol are
+ * moved into a 32-bit lane with a byte shuffle and a variable shift, then split into the I (even bits) and Q (odd bits)
+ * indexes which select the amplitudes through a permutation. Returns the number of mapped symbols, the remaining ones
+ * start byte aligned.
+ */
+static uint32_t mod_axis_avx2(const srsran_modem_table_t* q, const uint8_t* bits, cf_t* symbols, uint32_t nbits)
+{
+  uint32_t m      = q->nbits_x_symbol;
+  uint32_t m2     = m / 2;
+  uint32_t nbytes = nbits / 8;
+
+  // Lane k takes the 16 bits starting at byte (m * k) / 8 in big endian order and shifts them down to the LSB
+  int8_t  shuffle_bytes[32];
+  int32_t shift_lanes[8];
+  for (uint32_t k = 0; k < 8; k++) {
+    uint32_t byte_idx = (m * k) / 8;
+    uint32_t bit_off  = (m * k) % 8;
+
+    // Both 128-bit halves hold the same input bytes, so the shuffle indexes are the same in either half
+    shuffle_bytes[4 * k + 0] = (int8_t)((bit_off + m > 8) ? byte_idx + 1 : 0x80);
+    shuffle_bytes[4 * k + 1] = (int8_t)byte_idx;
+    shuffle_bytes[4 * k + 2] = (int8_t)0x80;
+    shuffle_bytes[4 * k + 3] = (int8_t)0x80;
+    shift_lanes[k]           = (int32_t)(16 - bit_off - m);
+  }
+  __m256i shuffle = _mm256_loadu_si256((__m256i*)shuffle_bytes);
+  __m256i shift   = _mm256_loadu_si256((__m256i*)shift_lanes);
+  __m256i mask    = _mm256_set1_epi32((1 << m) - 1);
+
+  __m256 lut_i_lo = _mm256_loadu_ps(&q->axis_table_i[0]);
+  __m256 lut_i_hi = _mm256_loadu_ps(&q->axis_table_i[8]);
+  __m256 lut_q_lo = _mm256_loadu_ps(&q->axis_table_q[0]);
+  __m256 lut_q_hi = _mm256_loadu_ps(&q->axis_table_q[8]);
+
+  uint32_t i = 0;
+  for (uint32_t n = 0; n + 8 <= nbytes; n += m, i += 8) {
+    __m256i v = _mm256_broadcastsi128_si256(_mm_loadl_epi64((__m128i*)&bits[n]));
+    v         = _mm256_shuffle_epi8(v, shuffle);
+    v         = _mm256_srlv_epi32(v, shift);
+    v         = _mm256_and_si256(v, mask);
+
+    // De-interleave the I and Q bits
+    __m256i idx_i = _mm256_setzero_si256();
+    __m256i idx_q = _mm256_setzero_si256();
+    for (uint32_t j = 0; j < m2; j++) {
+      __m256i bit = _mm256_set1_epi32(1 << (m2 - 1 - j));
+      idx_i = _mm256_or_si256(idx_i, _mm256_and_si256(_mm256_srl_epi32(v, _mm_cvtsi32_si128(m2 - j)), bit));
+      idx_q = _mm256_or_si256(idx_q, _mm256_and_si256(_mm256_srl_epi32(v, _mm_cvtsi32_si128(m2 - 1 - j)), bit));
+    }
+
+    // Look-up amplitudes, tables larger than 8 entries are selected with the index bit 3
+    __m256 re = _mm256_permutevar8x32_ps(lut_i_lo, idx_i);
+    __m256 im = _mm256_permutevar8x32_ps(lut_q_lo, idx_q);
+    if (m2 > 3) {
+      re = _mm256_blendv_ps(
+          re, _mm256_permutevar8x32_ps(lut_i_hi, idx_i), _mm256_castsi256_ps(_mm256_slli_epi32(idx_i, 28)));
+      im = _mm256_blendv_ps(
+          im, _mm256_permutevar8x32_ps(lut_q_hi, idx_q), _mm256_castsi256_ps(_mm256_slli_epi32(idx_q, 28)));
+    }
+
+    // Interleave real and imaginary parts
+    __m256 lo = _mm256_unpacklo_ps(re, im);
+    __m256 hi = _mm256_unpackhi_ps(re, im);
+    _mm256_storeu_ps((float*)&symbols[i], _mm256_permute2f128_ps(lo, hi, 0x20));
+    _mm256_storeu_ps((float*)&symbols[i + 4], _mm256_permute2f128_ps(lo, hi, 0x31));
+  }
+
+  return i;
+}
+#endif /* LV_HAVE_AVX2 */
+
 /* Assumes packet bits as input */
 int srsran_mod_modulate_bytes(const srsran_modem_table_t* q, const uint8_t* bits, cf_t* symbols, uint32_t nbits)
 {
@@ -142,6 +227,19 @@ int srsran_mod_modulate_bytes(const srsran_modem_table_t* q, const uint8_t* bits
     ERROR("Error modulator expects number of bits (%d) to be multiple of %d", nbits, q->nbits_x_symbol);
     return -1;
   }
+
+  uint32_t nsymbols = nbits / q->nbits_x_symbol;
+
+#ifdef LV_HAVE_AVX2
+  // The byte tables are faster for BPSK and QPSK
+  if (q->axis_tables_init && q->nbits_x_symbol >= 4) {
+    uint32_t n = mod_axis_avx2(q, bits, symbols, nbits);
+    bits += (n * q->nbits_x_symbol) / 8;
+    symbols += n;
+    nbits -= n * q->nbits_x_symbol;
+  }
+#endif /* LV_HAVE_AVX2 */
+
   switch (q->nbits_x_symbol) {
     case 1:
       mod_bpsk_bytes(q, bits, symbols, nbits);
@@ -162,5 +260,33 @@ int srsran_mod_modulate_bytes(const srsran_modem_table_t* q, const uint8_t* bits
       ERROR("srsran_mod_modulate_bytes() accepts QPSK/16QAM/64QAM modulations only");
       return SRSRAN_ERROR;
   }
-  return nbits / q->nbits_x_symbol;
+  return nsymbols;
+}
+
+int srsran_mod_modulate_bytes_scrambled(const srsran_modem_table_t* q,
+                                        srsran_sequence_state_t*    sequence_state,
+                                        const uint8_t*              bits,
+                                        cf_t*                       symbols,
+                                        uint32_t                    nbits)
+{
+  if (q == NULL || sequence_state == NULL || bits == NULL || symbols == NULL) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  // The scrambled block stays in L1, the scrambled codeword is never written to memory
+  uint8_t  block[MOD_SCRAMBLING_BLOCK_BYTES];
+  uint32_t nsymbols = 0;
+  for (uint32_t i = 0; i < nbits; i += MOD_SCRAMBLING_BLOCK_BYTES * 8) {
+    uint32_t block_nbits = SRSRAN_MIN(nbits - i, MOD_SCRAMBLING_BLOCK_BYTES * 8);
+
+    srsran_sequence_state_apply_packed(sequence_state, &bits[i / 8], block, block_nbits);
+
+    int n = srsran_mod_modulate_bytes(q, block, &symbols[nsymbols], block_nbits);
+    if (n < SRSRAN_SUCCESS) {
+      return n;
+    }
+    nsymbols += (uint32_t)n;
+  }
+
+  return (int)nsymbols;
 }
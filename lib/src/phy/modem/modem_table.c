@@ -128,6 +128,47 @@ int srsran_modem_table_lte(srsran_modem_table_t* q, srsran_mod_t modulation)
   return SRSRAN_SUCCESS;
 }
 
+/* Extracts the I (even) or Q (odd) bits of a symbol index, most significant bit first */
+static uint32_t table_axis_index(uint32_t idx, uint32_t nbits_x_symbol, bool odd)
+{
+  uint32_t axis_idx = 0;
+  for (uint32_t j = (odd ? 1 : 0); j < nbits_x_symbol; j += 2) {
+    axis_idx = (axis_idx << 1U) | ((idx >> (nbits_x_symbol - 1 - j)) & 1U);
+  }
+  return axis_idx;
+}
+
+/* Fills the per-axis amplitude tables if every symbol in the table can be expressed as I[even bits] + jQ[odd bits] */
+static void table_axis_create(srsran_modem_table_t* q)
+{
+  q->axis_tables_init = false;
+
+  if (q->nbits_x_symbol < 2 || q->nbits_x_symbol % 2 != 0 ||
+      (1U << (q->nbits_x_symbol / 2)) > SRSRAN_MODEM_AXIS_TABLE_SIZE) {
+    return;
+  }
+
+  bool is_set_i[SRSRAN_MODEM_AXIS_TABLE_SIZE] = {};
+  bool is_set_q[SRSRAN_MODEM_AXIS_TABLE_SIZE] = {};
+  for (uint32_t i = 0; i < q->nsymbols; i++) {
+    uint32_t idx_i = table_axis_index(i, q->nbits_x_symbol, false);
+    uint32_t idx_q = table_axis_index(i, q->nbits_x_symbol, true);
+    float    re    = __real__ q->symbol_table[i];
+    float    im    = __imag__ q->symbol_table[i];
+
+    // Any mismatch means the constellation is not separable
+    if ((is_set_i[idx_i] && q->axis_table_i[idx_i] != re) || (is_set_q[idx_q] && q->axis_table_q[idx_q] != im)) {
+      return;
+    }
+    q->axis_table_i[idx_i] = re;
+    q->axis_table_q[idx_q] = im;
+    is_set_i[idx_i]        = true;
+    is_set_q[idx_q]        = true;
+  }
+
+  q->axis_tables_init = true;
+}
+
 void srsran_modem_table_bytes(srsran_modem_table_t* q)
 {
   uint8_t mask_qpsk[4]  = {0xc0, 0x30, 0xc, 0x3};
@@ -168,4 +209,6 @@ void srsran_modem_table_bytes(srsran_modem_table_t* q)
       q->byte_tables_init = true;
       break;
   }
+
+  table_axis_create(q);
 }
@@ -88,7 +88,7 @@ int main(int argc, char** argv)
   int                  i;
   srsran_modem_table_t mod;
   uint8_t *            input, *input_bytes, *output;
-  cf_t *               symbols, *symbols_bytes;
+  cf_t *               symbols, *symbols_bytes, *symbols_scrambled;
   float*               llr;
   srsran_random_t      random_gen = srsran_random_init(0x1234);
 
@@ -134,6 +134,11 @@ int main(int argc, char** argv)
     perror("malloc");
     exit(-1);
   }
+  symbols_scrambled = srsran_vec_cf_malloc(num_bits / mod.nbits_x_symbol);
+  if (!symbols_scrambled) {
+    perror("malloc");
+    exit(-1);
+  }
 
   llr = srsran_vec_f_malloc(num_bits);
   if (!llr) {
@@ -168,13 +173,42 @@ int main(int argc, char** argv)
   get_time_interval(t);
 
   printf("Byte: %ld us\n", t[0].tv_usec);
-  for (int j = 0; i < num_bits / mod.nbits_x_symbol; j++) {
+  for (int j = 0; j < num_bits / mod.nbits_x_symbol; j++) {
     if (symbols[j] != symbols_bytes[j]) {
       printf("error in symbol %d\n", j);
       exit(-1);
     }
   }
 
+  /* Test fused scrambling and modulation against scrambling followed by modulation */
+  uint32_t seed = 0x1234;
+  gettimeofday(&t[1], NULL);
+  for (int j = 0; j < ntrials; j++) {
+    srsran_sequence_apply_packed(input_bytes, output, num_bits, seed);
+    srsran_mod_modulate_bytes(&mod, output, symbols_bytes, num_bits);
+  }
+  gettimeofday(&t[2], NULL);
+  get_time_interval(t);
+
+  printf("Scrambling + byte: %ld us\n", t[0].tv_usec);
+
+  srsran_sequence_state_t sequence_state = {};
+  gettimeofday(&t[1], NULL);
+  for (int j = 0; j < ntrials; j++) {
+    srsran_sequence_state_init(&sequence_state, seed);
+    srsran_mod_modulate_bytes_scrambled(&mod, &sequence_state, input_bytes, symbols_scrambled, num_bits);
+  }
+  gettimeofday(&t[2], NULL);
+  get_time_interval(t);
+
+  printf("Fused scrambling byte: %ld us\n", t[0].tv_usec);
+  for (int j = 0; j < num_bits / mod.nbits_x_symbol; j++) {
+    if (symbols_scrambled[j] != symbols_bytes[j]) {
+      printf("error in scrambled symbol %d\n", j);
+      exit(-1);
+    }
+  }
+
   srsran_vec_f_zero(llr, num_bits / mod.nbits_x_symbol);
 
   printf("Symbols OK\n");
@@ -198,6 +232,7 @@ int main(int argc, char** argv)
   free(llr);
   free(symbols);
   free(symbols_bytes);
+  free(symbols_scrambled);
   free(output);
   free(input);
   free(input_bytes);
@@ -392,7 +392,8 @@ uint32_t srsran_pbch_crc_check(srsran_pbch_t* q, uint8_t* bits, uint32_t nof_por
   }
 }
 
-int decode_frame(srsran_pbch_t* q, uint32_t src, uint32_t dst, uint32_t n, uint32_t nof_bits, uint32_t nof_ports)
+/* Places n frames starting at src in the position dst of the 40 ms codeword and rate dematches it into rm_f */
+static int rm_frame(srsran_pbch_t* q, uint32_t src, uint32_t dst, uint32_t n, uint32_t nof_bits, float* rm_f)
 {
   int j;
 
@@ -410,19 +411,12 @@ int decode_frame(srsran_pbch_t* q, uint32_t src, uint32_t dst, uint32_t n, uint3
     }
 
     /* unrate matching */
-    srsran_rm_conv_rx(q->temp, 4 * nof_bits, q->rm_f, SRSRAN_BCH_ENCODED_LEN);
+    srsran_rm_conv_rx(q->temp, 4 * nof_bits, rm_f, SRSRAN_BCH_ENCODED_LEN);
 
     /* Normalize LLR */
-    srsran_vec_sc_prod_fff(q->rm_f, 1.0 / ((float)2 * n), q->rm_f, SRSRAN_BCH_ENCODED_LEN);
+    srsran_vec_sc_prod_fff(rm_f, 1.0 / ((float)2 * n), rm_f, SRSRAN_BCH_ENCODED_LEN);
 
-    /* decode */
-    srsran_viterbi_decode_f(&q->decoder, q->rm_f, q->data, SRSRAN_BCH_PAYLOADCRC_LEN);
-
-    if (!srsran_pbch_crc_check(q, q->data, nof_ports)) {
-      return 1;
-    } else {
-      return SRSRAN_SUCCESS;
-    }
+    return SRSRAN_SUCCESS;
   } else {
     ERROR("Error in PBCH decoder: Invalid frame pointers dst=%d, src=%d, n=%d", src, dst, n);
     return -1;
@@ -516,9 +510,25 @@ int srsran_pbch_decode(srsran_pbch_t*         q,
          */
         for (nb = 0; nb < frame_idx; nb++) {
           for (dst = 0; (dst < 4 - nb); dst++) {
-            for (src = 0; src < frame_idx - nb; src++) {
-              ret = decode_frame(q, src, dst, nb + 1, nof_bits, nant);
-              if (ret == 1) {
+            /* decode all the sources for this position at once, then check them in order */
+            uint32_t nof_src = frame_idx - nb;
+            float*   rm_f[4];
+            uint8_t* data[4];
+            for (src = 0; src < nof_src; src++) {
+              rm_f[src] = q->rm_f_batch[src];
+              data[src] = q->data_batch[src];
+              if (rm_frame(q, src, dst, nb + 1, nof_bits, rm_f[src]) < SRSRAN_SUCCESS) {
+                return SRSRAN_ERROR;
+              }
+            }
+            if (srsran_viterbi_decode_batch_f(&q->decoder, rm_f, data, nof_src, SRSRAN_BCH_PAYLOADCRC_LEN) <
+                SRSRAN_SUCCESS) {
+              return SRSRAN_ERROR;
+            }
+
+            for (src = 0; src < nof_src; src++) {
+              if (!srsran_pbch_crc_check(q, data[src], nant)) {
+                memcpy(q->data, data[src], SRSRAN_BCH_PAYLOADCRC_LEN);
                 if (sfn_offset) {
                   *sfn_offset = (int)dst - src + frame_idx - 1;
                 }
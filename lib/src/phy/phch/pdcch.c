@@ -328,6 +328,14 @@ uint32_t srsran_pdcch_common_locations_ncce(uint32_t nof_cce, srsran_dci_locatio
   return k;
 }
 
+static uint16_t pdcch_dci_crc_rem(srsran_pdcch_t* q, uint8_t* data, uint32_t nof_bits)
+{
+  uint8_t* x       = &data[nof_bits];
+  uint16_t p_bits  = (uint16_t)srsran_bit_pack(&x, 16);
+  uint16_t crc_res = ((uint16_t)srsran_crc_checksum(&q->crc, data, nof_bits) & 0xffff);
+  return p_bits ^ crc_res;
+}
+
 /** 36.212 5.3.3.2 to 5.3.3.4
  *
  * Returns XOR between parity and remainder bits
@@ -336,9 +344,6 @@ uint32_t srsran_pdcch_common_locations_ncce(uint32_t nof_cce, srsran_dci_locatio
  */
 int srsran_pdcch_dci_decode(srsran_pdcch_t* q, float* e, uint8_t* data, uint32_t E, uint32_t nof_bits, uint16_t* crc)
 {
-  uint16_t p_bits, crc_res;
-  uint8_t* x;
-
   if (q != NULL) {
     if (data != NULL && E <= q->max_bits && nof_bits <= SRSRAN_DCI_MAX_BITS) {
       srsran_vec_f_zero(q->rm_f, 3 * (SRSRAN_DCI_MAX_BITS + 16));
@@ -351,12 +356,8 @@ int srsran_pdcch_dci_decode(srsran_pdcch_t* q, float* e, uint8_t* data, uint32_t
       /* viterbi decoder */
       srsran_viterbi_decode_f(&q->decoder, q->rm_f, data, nof_bits + 16);
 
-      x       = &data[nof_bits];
-      p_bits  = (uint16_t)srsran_bit_pack(&x, 16);
-      crc_res = ((uint16_t)srsran_crc_checksum(&q->crc, data, nof_bits) & 0xffff);
-
       if (crc) {
-        *crc = p_bits ^ crc_res;
+        *crc = pdcch_dci_crc_rem(q, data, nof_bits);
       }
 
       return SRSRAN_SUCCESS;
@@ -369,6 +370,60 @@ int srsran_pdcch_dci_decode(srsran_pdcch_t* q, float* e, uint8_t* data, uint32_t
   }
 }
 
+float srsran_pdcch_location_llr_mean(srsran_pdcch_t* q, srsran_dl_sf_cfg_t* sf, const srsran_dci_location_t* location)
+{
+  if (q == NULL || sf == NULL || location == NULL || !srsran_dci_location_isvalid(location) ||
+      location->ncce * 72 + PDCCH_FORMAT_NOF_BITS(location->L) > NOF_CCE(sf->cfi) * 72) {
+    return 0.0f;
+  }
+
+  uint32_t     e_bits = PDCCH_FORMAT_NOF_BITS(location->L);
+  const float* llr    = &q->llr[location->ncce * 72];
+
+  double mean = 0;
+  for (uint32_t i = 0; i < e_bits; i++) {
+    mean += fabsf(llr[i]);
+  }
+
+  return (float)(mean / e_bits);
+}
+
+/** Tries to decode a DCI message from the LLRs stored in the srsran_pdcch_t structure by the function
+ * srsran_pdcch_extract_llr(). This function can be called multiple times.
+ * The location to search for is obtained from msg.
+ * The decoded message is stored in msg and the CRC remainder in msg->rnti
+ *
+ */
+static bool pdcch_location_isvalid(srsran_pdcch_t* q, srsran_dl_sf_cfg_t* sf, srsran_dci_msg_t* msg)
+{
+  if (!srsran_dci_location_isvalid(&msg->location)) {
+    ERROR("Invalid parameters, location=%d,%d", msg->location.ncce, msg->location.L);
+    return false;
+  }
+  if (msg->location.ncce * 72 + PDCCH_FORMAT_NOF_BITS(msg->location.L) > NOF_CCE(sf->cfi) * 72) {
+    ERROR("Invalid location: nCCE: %d, L: %d, NofCCE: %d", msg->location.ncce, msg->location.L, NOF_CCE(sf->cfi));
+    return false;
+  }
+  return true;
+}
+
+static void
+pdcch_decode_msg_complete(srsran_dci_cfg_t* dci_cfg, srsran_dci_msg_t* msg, uint32_t nof_bits, float mean)
+{
+  msg->nof_bits = nof_bits;
+  // Check format differentiation
+  if (msg->format == SRSRAN_DCI_FORMAT0 || msg->format == SRSRAN_DCI_FORMAT1A) {
+    msg->format = (msg->payload[dci_cfg->cif_enabled ? 3 : 0] == 0) ? SRSRAN_DCI_FORMAT0 : SRSRAN_DCI_FORMAT1A;
+  }
+  INFO("Decoded DCI: nCCE=%d, L=%d, format=%s, msg_len=%d, mean=%f, crc_rem=0x%x",
+       msg->location.ncce,
+       msg->location.L,
+       srsran_dci_format_string(msg->format),
+       nof_bits,
+       mean,
+       msg->rnti);
+}
+
 /** Tries to decode a DCI message from the LLRs stored in the srsran_pdcch_t structure by the function
  * srsran_pdcch_extract_llr(). This function can be called multiple times.
  * The location to search for is obtained from msg.
@@ -378,50 +433,116 @@ int srsran_pdcch_dci_decode(srsran_pdcch_t* q, float* e, uint8_t* data, uint32_t
 int srsran_pdcch_decode_msg(srsran_pdcch_t* q, srsran_dl_sf_cfg_t* sf, srsran_dci_cfg_t* dci_cfg, srsran_dci_msg_t* msg)
 {
   int ret = SRSRAN_ERROR_INVALID_INPUTS;
-  if (q != NULL && msg != NULL && srsran_dci_location_isvalid(&msg->location)) {
-    if (msg->location.ncce * 72 + PDCCH_FORMAT_NOF_BITS(msg->location.L) > NOF_CCE(sf->cfi) * 72) {
-      ERROR("Invalid location: nCCE: %d, L: %d, NofCCE: %d", msg->location.ncce, msg->location.L, NOF_CCE(sf->cfi));
-    } else {
-      ret = SRSRAN_SUCCESS;
+  if (q != NULL && msg != NULL && pdcch_location_isvalid(q, sf, msg)) {
+    ret = SRSRAN_SUCCESS;
 
-      uint32_t nof_bits = srsran_dci_format_sizeof(&q->cell, sf, dci_cfg, msg->format);
-      uint32_t e_bits   = PDCCH_FORMAT_NOF_BITS(msg->location.L);
+    uint32_t nof_bits = srsran_dci_format_sizeof(&q->cell, sf, dci_cfg, msg->format);
+    uint32_t e_bits   = PDCCH_FORMAT_NOF_BITS(msg->location.L);
 
-      // Compute absolute mean of the LLRs
-      double mean = 0;
-      for (int i = 0; i < e_bits; i++) {
-        mean += fabsf(q->llr[msg->location.ncce * 72 + i]);
-      }
-      mean /= e_bits;
-
-      if (mean > 0.3f) {
-        ret = srsran_pdcch_dci_decode(q, &q->llr[msg->location.ncce * 72], msg->payload, e_bits, nof_bits, &msg->rnti);
-        if (ret == SRSRAN_SUCCESS) {
-          msg->nof_bits = nof_bits;
-          // Check format differentiation
-          if (msg->format == SRSRAN_DCI_FORMAT0 || msg->format == SRSRAN_DCI_FORMAT1A) {
-            msg->format = (msg->payload[dci_cfg->cif_enabled ? 3 : 0] == 0) ? SRSRAN_DCI_FORMAT0 : SRSRAN_DCI_FORMAT1A;
-          }
-        } else {
-          ERROR("Error calling pdcch_dci_decode");
-        }
-        INFO("Decoded DCI: nCCE=%d, L=%d, format=%s, msg_len=%d, mean=%f, crc_rem=0x%x",
-             msg->location.ncce,
-             msg->location.L,
-             srsran_dci_format_string(msg->format),
-             nof_bits,
-             mean,
-             msg->rnti);
+    // Compute absolute mean of the LLRs
+    float mean = srsran_pdcch_location_llr_mean(q, sf, &msg->location);
+
+    if (mean > SRSRAN_PDCCH_LLR_MEAN_MIN) {
+      ret = srsran_pdcch_dci_decode(q, &q->llr[msg->location.ncce * 72], msg->payload, e_bits, nof_bits, &msg->rnti);
+      if (ret == SRSRAN_SUCCESS) {
+        pdcch_decode_msg_complete(dci_cfg, msg, nof_bits, mean);
       } else {
-        INFO("Skipping DCI:  nCCE=%d, L=%d, msg_len=%d, mean=%f", msg->location.ncce, msg->location.L, nof_bits, mean);
+        ERROR("Error calling pdcch_dci_decode");
       }
+    } else {
+      INFO("Skipping DCI:  nCCE=%d, L=%d, msg_len=%d, mean=%f", msg->location.ncce, msg->location.L, nof_bits, mean);
     }
-  } else if (msg != NULL) {
-    ERROR("Invalid parameters, location=%d,%d", msg->location.ncce, msg->location.L);
   }
   return ret;
 }
 
+/* Viterbi decodes the candidates gathered by srsran_pdcch_decode_msg_batch(), which have all the same size */
+static int pdcch_decode_msg_flush(srsran_pdcch_t*   q,
+                                  srsran_dci_cfg_t* dci_cfg,
+                                  srsran_dci_msg_t* msgs[SRSRAN_VITERBI_MAX_BATCH],
+                                  float             mean[SRSRAN_VITERBI_MAX_BATCH],
+                                  uint32_t          nof_msgs,
+                                  uint32_t          nof_bits)
+{
+  float*   rm_f[SRSRAN_VITERBI_MAX_BATCH];
+  uint8_t* data[SRSRAN_VITERBI_MAX_BATCH];
+
+  if (nof_msgs == 0) {
+    return SRSRAN_SUCCESS;
+  }
+
+  uint32_t coded_len = 3 * (nof_bits + 16);
+  for (uint32_t i = 0; i < nof_msgs; i++) {
+    rm_f[i] = q->rm_f_batch[i];
+    data[i] = msgs[i]->payload;
+    srsran_vec_f_zero(rm_f[i], 3 * (SRSRAN_DCI_MAX_BITS + 16));
+    srsran_rm_conv_rx(
+        &q->llr[msgs[i]->location.ncce * 72], PDCCH_FORMAT_NOF_BITS(msgs[i]->location.L), rm_f[i], coded_len);
+  }
+
+  if (srsran_viterbi_decode_batch_f(&q->decoder, rm_f, data, nof_msgs, nof_bits + 16) < SRSRAN_SUCCESS) {
+    ERROR("Error decoding DCI batch");
+    return SRSRAN_ERROR;
+  }
+
+  for (uint32_t i = 0; i < nof_msgs; i++) {
+    msgs[i]->rnti = pdcch_dci_crc_rem(q, msgs[i]->payload, nof_bits);
+    pdcch_decode_msg_complete(dci_cfg, msgs[i], nof_bits, mean[i]);
+  }
+
+  return SRSRAN_SUCCESS;
+}
+
+int srsran_pdcch_decode_msg_batch(srsran_pdcch_t*    q,
+                                  srsran_dl_sf_cfg_t* sf,
+                                  srsran_dci_cfg_t*   dci_cfg,
+                                  srsran_dci_msg_t*   msgs[],
+                                  uint32_t            nof_msgs)
+{
+  srsran_dci_msg_t* batch[SRSRAN_VITERBI_MAX_BATCH];
+  float             mean[SRSRAN_VITERBI_MAX_BATCH];
+  uint32_t          nof_batch      = 0;
+  uint32_t          batch_nof_bits = 0;
+
+  if (q == NULL || sf == NULL || dci_cfg == NULL || msgs == NULL) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  for (uint32_t i = 0; i < nof_msgs; i++) {
+    srsran_dci_msg_t* msg = msgs[i];
+    if (msg == NULL || !pdcch_location_isvalid(q, sf, msg)) {
+      return SRSRAN_ERROR_INVALID_INPUTS;
+    }
+
+    uint32_t nof_bits = srsran_dci_format_sizeof(&q->cell, sf, dci_cfg, msg->format);
+    if (nof_bits > SRSRAN_DCI_MAX_BITS) {
+      ERROR("Invalid parameters: nof_bits: %d", nof_bits);
+      return SRSRAN_ERROR_INVALID_INPUTS;
+    }
+
+    float llr_mean = srsran_pdcch_location_llr_mean(q, sf, &msg->location);
+    if (llr_mean <= SRSRAN_PDCCH_LLR_MEAN_MIN) {
+      INFO("Skipping DCI:  nCCE=%d, L=%d, msg_len=%d, mean=%f", msg->location.ncce, msg->location.L, nof_bits, llr_mean);
+      continue;
+    }
+
+    // Only candidates of the same size can be decoded together
+    if (nof_batch == SRSRAN_VITERBI_MAX_BATCH || (nof_batch > 0 && nof_bits != batch_nof_bits)) {
+      if (pdcch_decode_msg_flush(q, dci_cfg, batch, mean, nof_batch, batch_nof_bits) < SRSRAN_SUCCESS) {
+        return SRSRAN_ERROR;
+      }
+      nof_batch = 0;
+    }
+
+    batch[nof_batch]  = msg;
+    mean[nof_batch]   = llr_mean;
+    batch_nof_bits    = nof_bits;
+    nof_batch++;
+  }
+
+  return pdcch_decode_msg_flush(q, dci_cfg, batch, mean, nof_batch, batch_nof_bits);
+}
+
 float srsran_pdcch_msg_corr(srsran_pdcch_t* q, srsran_dci_msg_t* msg)
 {
   if (q == NULL || msg == NULL) {
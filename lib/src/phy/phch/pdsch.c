@@ -520,26 +520,40 @@ static float apply_power_allocation(srsran_pdsch_t* q, srsran_pdsch_cfg_t* cfg,
   return rho_a;
 }
 
-static void csi_correction(srsran_pdsch_t* q, srsran_pdsch_cfg_t* cfg, uint32_t codeword_idx, uint32_t tb_idx, void* e)
+static float csi_max_get(srsran_pdsch_t* q, uint32_t codeword_idx, uint32_t nof_re)
 {
-  uint32_t qm = srsran_mod_bits_x_symbol(cfg->grant.tb[tb_idx].mod);
+  const uint32_t csi_max_idx = srsran_vec_max_fi(q->csi[codeword_idx], nof_re);
+  float          csi_max     = 1.0f;
+  if (csi_max_idx < nof_re) {
+    csi_max = q->csi[codeword_idx][csi_max_idx];
+  }
+  return csi_max;
+}
+
+/* Scales the soft bits of nof_re resource elements, starting at re_offset, by their CSI normalised to csi_max */
+static void csi_correction_range(srsran_pdsch_t* q,
+                                 srsran_mod_t    mod,
+                                 uint32_t        codeword_idx,
+                                 uint32_t        re_offset,
+                                 uint32_t        nof_re,
+                                 float           csi_max,
+                                 void*           e)
+{
+  uint32_t qm = srsran_mod_bits_x_symbol(mod);
   if (qm == 0) {
     return;
   }
 
-  const uint32_t csi_max_idx = srsran_vec_max_fi(q->csi[codeword_idx], cfg->grant.tb[tb_idx].nof_bits / qm);
-  float          csi_max     = 1.0f;
-  if (csi_max_idx < cfg->grant.tb[tb_idx].nof_bits / qm) {
-    csi_max = q->csi[codeword_idx][csi_max_idx];
-  }
-  int8_t*  e_b   = e;
-  int16_t* e_s   = e;
-  float*   csi_v = q->csi[codeword_idx];
+  int8_t*      e_b      = (int8_t*)e + qm * re_offset;
+  int16_t*     e_s      = (int16_t*)e + qm * re_offset;
+  const float* csi      = &q->csi[codeword_idx][re_offset];
+  const float* csi_v    = csi;
+  uint32_t     nof_bits = qm * nof_re;
   if (q->llr_is_8bit) {
-    for (int i = 0; i < cfg->grant.tb[tb_idx].nof_bits / qm; i++) {
-      const float csi = *(csi_v++) / csi_max;
+    for (int i = 0; i < nof_bits / qm; i++) {
+      const float csi_i = *(csi_v++) / csi_max;
       for (int k = 0; k < qm; k++) {
-        *e_b = (int8_t)((float)*e_b * csi);
+        *e_b = (int8_t)((float)*e_b * csi_i);
         e_b++;
       }
     }
@@ -548,11 +562,11 @@ static void csi_correction(srsran_pdsch_t* q, srsran_pdsch_cfg_t* cfg, uint32_t
 
 #ifdef LV_HAVE_SSE
     __m128 _csi_scale = _mm_set1_ps(INT16_MAX / csi_max);
-    __m64* _e         = (__m64*)e;
+    __m64* _e         = (__m64*)e_s;
 
-    switch (cfg->grant.tb[tb_idx].mod) {
+    switch (mod) {
       case SRSRAN_MOD_QPSK:
-        for (; i < cfg->grant.tb[tb_idx].nof_bits - 3; i += 4) {
+        for (; i + 4 <= nof_bits; i += 4) {
           __m128 _csi1 = _mm_set1_ps(*(csi_v++));
           __m128 _csi2 = _mm_set1_ps(*(csi_v++));
           _csi1        = _mm_blend_ps(_csi1, _csi2, 3);
@@ -564,7 +578,7 @@ static void csi_correction(srsran_pdsch_t* q, srsran_pdsch_cfg_t* cfg, uint32_t
         }
         break;
       case SRSRAN_MOD_16QAM:
-        for (; i < cfg->grant.tb[tb_idx].nof_bits - 3; i += 4) {
+        for (; i + 4 <= nof_bits; i += 4) {
           __m128 _csi = _mm_set1_ps(*(csi_v++));
 
           _csi = _mm_mul_ps(_csi, _csi_scale);
@@ -574,7 +588,7 @@ static void csi_correction(srsran_pdsch_t* q, srsran_pdsch_cfg_t* cfg, uint32_t
         }
         break;
       case SRSRAN_MOD_64QAM:
-        for (; i < cfg->grant.tb[tb_idx].nof_bits - 11; i += 12) {
+        for (; i + 12 <= nof_bits; i += 12) {
           __m128 _csi1 = _mm_set1_ps(*(csi_v++));
           __m128 _csi3 = _mm_set1_ps(*(csi_v++));
 
@@ -591,7 +605,7 @@ static void csi_correction(srsran_pdsch_t* q, srsran_pdsch_cfg_t* cfg, uint32_t
       case SRSRAN_MOD_BPSK:
         break;
       case SRSRAN_MOD_256QAM:
-        for (; i < cfg->grant.tb[tb_idx].nof_bits - 7; i += 8) {
+        for (; i + 8 <= nof_bits; i += 8) {
           __m128 _csi = _mm_set1_ps(*(csi_v++));
 
           _csi = _mm_mul_ps(_csi, _csi_scale);
@@ -608,15 +622,68 @@ static void csi_correction(srsran_pdsch_t* q, srsran_pdsch_cfg_t* cfg, uint32_t
     i /= qm;
 #endif /* LV_HAVE_SSE */
 
-    for (; i < cfg->grant.tb[tb_idx].nof_bits / qm; i++) {
-      const float csi = q->csi[codeword_idx][i] / csi_max;
+    for (; i < nof_bits / qm; i++) {
+      const float csi_i = csi[i] / csi_max;
       for (int k = 0; k < qm; k++) {
-        e_s[qm * i + k] = (int16_t)((float)e_s[qm * i + k] * csi);
+        e_s[qm * i + k] = (int16_t)((float)e_s[qm * i + k] * csi_i);
       }
     }
   }
 }
 
+static void csi_correction(srsran_pdsch_t* q, srsran_pdsch_cfg_t* cfg, uint32_t codeword_idx, uint32_t tb_idx, void* e)
+{
+  uint32_t qm = srsran_mod_bits_x_symbol(cfg->grant.tb[tb_idx].mod);
+  if (qm == 0) {
+    return;
+  }
+
+  uint32_t nof_re = cfg->grant.tb[tb_idx].nof_bits / qm;
+  csi_correction_range(q, cfg->grant.tb[tb_idx].mod, codeword_idx, 0, nof_re, csi_max_get(q, codeword_idx, nof_re), e);
+}
+
+/* Streaming demodulation, descrambling and CSI correction state of a codeword, see pdsch_llr_stream() */
+typedef struct {
+  srsran_pdsch_t*         q;
+  srsran_mod_t            mod;
+  uint32_t                qm;
+  uint32_t                codeword_idx;
+  srsran_sequence_state_t sequence;
+  uint32_t                sequence_offset; ///< Bit the sequence state is aligned with
+  bool                    csi_enable;
+  float                   csi_max;
+} pdsch_llr_stream_t;
+
+/* Produces the soft bits of one code block, called by the DL-SCH decoder before rate dematching it */
+static void pdsch_llr_stream(void* arg, void* e, uint32_t offset, uint32_t nof_bits)
+{
+  pdsch_llr_stream_t* s         = (pdsch_llr_stream_t*)arg;
+  srsran_pdsch_t*     q         = s->q;
+  uint32_t            re_offset = offset / s->qm;
+  uint32_t            nof_re    = nof_bits / s->qm;
+  cf_t*               d         = &q->d[s->codeword_idx][re_offset];
+
+  // Skip the sequence over code blocks which are not decoded
+  if (offset > s->sequence_offset) {
+    srsran_sequence_state_advance(&s->sequence, offset - s->sequence_offset);
+  }
+  s->sequence_offset = offset + nof_bits;
+
+  if (q->llr_is_8bit) {
+    int8_t* e_b = (int8_t*)e + offset;
+    srsran_demod_soft_demodulate_b(s->mod, d, e_b, nof_re);
+    srsran_sequence_state_apply_c(&s->sequence, e_b, e_b, nof_bits);
+  } else {
+    int16_t* e_s = (int16_t*)e + offset;
+    srsran_demod_soft_demodulate_s(s->mod, d, e_s, nof_re);
+    srsran_sequence_state_apply_s(&s->sequence, e_s, e_s, nof_bits);
+  }
+
+  if (s->csi_enable) {
+    csi_correction_range(q, s->mod, s->codeword_idx, re_offset, nof_re, s->csi_max, e);
+  }
+}
+
 static void pdsch_decode_debug(srsran_pdsch_t*     q,
                                srsran_pdsch_cfg_t* cfg,
                                cf_t*               sf_symbols[SRSRAN_MAX_PORTS],
@@ -686,58 +753,75 @@ static int srsran_pdsch_codeword_decode(srsran_pdsch_t*     q,
          cfg->grant.tb[tb_idx].nof_bits,
          rv);
 
-    /* demodulate symbols
-     * The MAX-log-MAP algorithm used in turbo decoding is unsensitive to SNR estimation,
-     * thus we don't need tot set it in the LLRs normalization
-     */
-    if (q->llr_is_8bit) {
-      srsran_demod_soft_demodulate_b(mcs->mod, q->d[codeword_idx], q->e[codeword_idx], cfg->grant.nof_re);
+    // EVM and LLR debug need the soft bits of the whole codeword, otherwise they are produced per code block
+    if (!cfg->meas_evm_en && !SRSRAN_VERBOSE_ISDEBUG()) {
+      pdsch_llr_stream_t stream = {};
+      stream.q                  = q;
+      stream.mod                = mcs->mod;
+      stream.qm                 = srsran_mod_bits_x_symbol(mcs->mod);
+      stream.codeword_idx       = codeword_idx;
+      stream.csi_enable         = cfg->csi_enable;
+      stream.csi_max = cfg->csi_enable ? csi_max_get(q, codeword_idx, cfg->grant.tb[tb_idx].nof_bits / stream.qm) : 1.0f;
+      srsran_sequence_pdsch_state_init(
+          &stream.sequence, cfg->rnti, codeword_idx, 2 * (sf->tti % SRSRAN_NOF_SF_X_FRAME), q->cell.id);
+
+      data[tb_idx].evm = NAN;
+      ret              = srsran_dlsch_decode_stream(
+          dl_sch, cfg, pdsch_llr_stream, &stream, q->e[codeword_idx], data[tb_idx].payload, tb_idx, nof_layers);
     } else {
-      srsran_demod_soft_demodulate_s(mcs->mod, q->d[codeword_idx], q->e[codeword_idx], cfg->grant.nof_re);
-    }
-    if (cfg->meas_evm_en && q->evm_buffer[codeword_idx]) {
+      /* demodulate symbols
+       * The MAX-log-MAP algorithm used in turbo decoding is unsensitive to SNR estimation,
+       * thus we don't need tot set it in the LLRs normalization
+       */
       if (q->llr_is_8bit) {
-        data[tb_idx].evm = srsran_evm_run_b(q->evm_buffer[codeword_idx],
-                                            &q->mod[mcs->mod],
-                                            q->d[codeword_idx],
-                                            q->e[codeword_idx],
-                                            cfg->grant.tb[tb_idx].nof_bits);
+        srsran_demod_soft_demodulate_b(mcs->mod, q->d[codeword_idx], q->e[codeword_idx], cfg->grant.nof_re);
       } else {
-        data[tb_idx].evm = srsran_evm_run_s(q->evm_buffer[codeword_idx],
-                                            &q->mod[mcs->mod],
-                                            q->d[codeword_idx],
-                                            q->e[codeword_idx],
-                                            cfg->grant.tb[tb_idx].nof_bits);
+        srsran_demod_soft_demodulate_s(mcs->mod, q->d[codeword_idx], q->e[codeword_idx], cfg->grant.nof_re);
+      }
+      if (cfg->meas_evm_en && q->evm_buffer[codeword_idx]) {
+        if (q->llr_is_8bit) {
+          data[tb_idx].evm = srsran_evm_run_b(q->evm_buffer[codeword_idx],
+                                              &q->mod[mcs->mod],
+                                              q->d[codeword_idx],
+                                              q->e[codeword_idx],
+                                              cfg->grant.tb[tb_idx].nof_bits);
+        } else {
+          data[tb_idx].evm = srsran_evm_run_s(q->evm_buffer[codeword_idx],
+                                              &q->mod[mcs->mod],
+                                              q->d[codeword_idx],
+                                              q->e[codeword_idx],
+                                              cfg->grant.tb[tb_idx].nof_bits);
+        }
+      } else {
+        data[tb_idx].evm = NAN;
       }
-    } else {
-      data[tb_idx].evm = NAN;
-    }
 
-    /* Bit scrambling */
-    if (q->llr_is_8bit) {
-      srsran_sequence_pdsch_apply_c(q->e[codeword_idx],
-                                    q->e[codeword_idx],
-                                    cfg->rnti,
-                                    codeword_idx,
-                                    2 * (sf->tti % SRSRAN_NOF_SF_X_FRAME),
-                                    q->cell.id,
-                                    cfg->grant.tb[tb_idx].nof_bits);
-    } else {
-      srsran_sequence_pdsch_apply_s(q->e[codeword_idx],
-                                    q->e[codeword_idx],
-                                    cfg->rnti,
-                                    codeword_idx,
-                                    2 * (sf->tti % SRSRAN_NOF_SF_X_FRAME),
-                                    q->cell.id,
-                                    cfg->grant.tb[tb_idx].nof_bits);
-    }
+      /* Bit scrambling */
+      if (q->llr_is_8bit) {
+        srsran_sequence_pdsch_apply_c(q->e[codeword_idx],
+                                      q->e[codeword_idx],
+                                      cfg->rnti,
+                                      codeword_idx,
+                                      2 * (sf->tti % SRSRAN_NOF_SF_X_FRAME),
+                                      q->cell.id,
+                                      cfg->grant.tb[tb_idx].nof_bits);
+      } else {
+        srsran_sequence_pdsch_apply_s(q->e[codeword_idx],
+                                      q->e[codeword_idx],
+                                      cfg->rnti,
+                                      codeword_idx,
+                                      2 * (sf->tti % SRSRAN_NOF_SF_X_FRAME),
+                                      q->cell.id,
+                                      cfg->grant.tb[tb_idx].nof_bits);
+      }
 
-    if (cfg->csi_enable) {
-      csi_correction(q, cfg, codeword_idx, tb_idx, q->e[codeword_idx]);
-    }
+      if (cfg->csi_enable) {
+        csi_correction(q, cfg, codeword_idx, tb_idx, q->e[codeword_idx]);
+      }
 
-    /* Return  */
-    ret = srsran_dlsch_decode2(dl_sch, cfg, q->e[codeword_idx], data[tb_idx].payload, tb_idx, nof_layers);
+      /* Return  */
+      ret = srsran_dlsch_decode2(dl_sch, cfg, q->e[codeword_idx], data[tb_idx].payload, tb_idx, nof_layers);
+    }
 
     if (ret == SRSRAN_SUCCESS) {
       *ack = true;
@@ -994,18 +1078,18 @@ static int srsran_pdsch_codeword_encode(srsran_pdsch_t*         q,
       return SRSRAN_ERROR;
     }
 
-    /* Bit scrambling */
-    srsran_sequence_pdsch_apply_pack((uint8_t*)q->e[codeword_idx],
-                                     (uint8_t*)q->e[codeword_idx],
-                                     cfg->rnti,
-                                     codeword_idx,
-                                     2 * (sf->tti % SRSRAN_NOF_SF_X_FRAME),
-                                     q->cell.id,
-                                     cfg->grant.tb[tb_idx].nof_bits);
-
-    /* Bit mapping */
-    srsran_mod_modulate_bytes(
-        &q->mod[mcs->mod], (uint8_t*)q->e[codeword_idx], q->d[codeword_idx], cfg->grant.tb[tb_idx].nof_bits);
+    /* Bit scrambling and mapping, fused in a single pass over the codeword */
+    srsran_sequence_state_t sequence_state = {};
+    srsran_sequence_pdsch_state_init(
+        &sequence_state, cfg->rnti, codeword_idx, 2 * (sf->tti % SRSRAN_NOF_SF_X_FRAME), q->cell.id);
+    if (srsran_mod_modulate_bytes_scrambled(&q->mod[mcs->mod],
+                                            &sequence_state,
+                                            (uint8_t*)q->e[codeword_idx],
+                                            q->d[codeword_idx],
+                                            cfg->grant.tb[tb_idx].nof_bits) < SRSRAN_SUCCESS) {
+      ERROR("Error modulating (TB%d -> CW%d)", tb_idx, codeword_idx);
+      return SRSRAN_ERROR;
+    }
 
   } else {
     return SRSRAN_ERROR_INVALID_INPUTS;
@@ -562,6 +562,7 @@ int srsran_prach_init(srsran_prach_t* p, uint32_t max_N_ifft_ul)
     bzero(p, sizeof(srsran_prach_t));
 
     p->max_N_ifft_ul = max_N_ifft_ul;
+    p->nof_batches   = 1;
 
     // Set up containers
     p->prach_bins = srsran_vec_cf_malloc(SRSRAN_PRACH_N_ZC_LONG);
@@ -641,6 +642,7 @@ int srsran_prach_set_cell_(srsran_prach_t*      p,
     p->num_ra_preambles        = cfg->num_ra_preambles;
     p->successive_cancellation = cfg->enable_successive_cancellation;
     p->dft_gen_bitmap          = 0;
+    p->batch_ready             = false;
     if (p->successive_cancellation && cfg->zero_corr_zone != 0) {
       printf("successive cancellation only currently supported with zero_correlation_zone_config of 0 - disabling\n");
       p->successive_cancellation = false;
@@ -843,12 +845,11 @@ float srsran_prach_get_offset_secs(srsran_prach_t* p, int n_win)
   return (float)p->peak_offsets[n_win] / (float)(DELTA_F_RA * p->N_zc);
 }
 
-// calculates the timing offset of the incoming PRACH by calculating the phase in frequency - alternative to time domain
-// approach
-float srsran_prach_calculate_time_offset_secs(srsran_prach_t* p, cf_t* cross)
+// calculates the timing offset of the incoming PRACH from the sum of the cross correlation of consecutive bins
+static float prach_time_offset_secs_from_cross(const srsran_prach_t* p, cf_t cross_acc)
 {
   // calculate the phase of the cross correlation
-  float freq_domain_phase = cargf(srsran_vec_acc_cc(cross, p->N_zc));
+  float freq_domain_phase = cargf(cross_acc);
   float ratio             = (float)(p->N_ifft_ul * DELTA_F) / (float)(SRSRAN_PRACH_N_ZC_LONG * DELTA_F_RA);
   // converting from phase to number of samples
   float num_samples = roundf((ratio * freq_domain_phase * p->N_zc) / (2 * M_PI));
@@ -856,6 +857,13 @@ float srsran_prach_calculate_time_offset_secs(srsran_prach_t* p, cf_t* cross)
   // converting to time in seconds
   return num_samples / ((float)p->N_ifft_ul * DELTA_F);
 }
+
+// calculates the timing offset of the incoming PRACH by calculating the phase in frequency - alternative to time domain
+// approach
+float srsran_prach_calculate_time_offset_secs(srsran_prach_t* p, cf_t* cross)
+{
+  return prach_time_offset_secs_from_cross(p, srsran_vec_acc_cc(cross, p->N_zc));
+}
 // calculates the aggregate phase offset of the incomming PRACH signal so it can be applied to the reference signal
 // before it is subtracted from the input
 void srsran_prach_calculate_correction_array(srsran_prach_t* p, cf_t* corr_freq)
@@ -866,6 +874,41 @@ void srsran_prach_calculate_correction_array(srsran_prach_t* p, cf_t* corr_freq)
   }
 }
 
+// Number of cyclic shifts of each root, each one is searched in its own correlation window
+static uint32_t prach_nof_windows(const srsran_prach_t* p)
+{
+  uint32_t winsize = (p->N_cs != 0) ? p->N_cs : p->N_zc;
+  return p->N_zc / winsize;
+}
+
+// Finds the peak of each correlation window of a root and returns the highest one
+static float prach_find_peaks(const srsran_prach_t* p, const float* corr, float* peak_values, uint32_t* peak_offsets)
+{
+  uint32_t winsize = (p->N_cs != 0) ? p->N_cs : p->N_zc;
+  uint32_t n_wins  = p->N_zc / winsize;
+
+  float max_peak = 0;
+  for (int j = 0; j < n_wins; j++) {
+    uint32_t start = (p->N_zc - (j * p->N_cs)) % p->N_zc;
+    uint32_t end   = start + winsize;
+    if (end > p->deadzone) {
+      end -= p->deadzone;
+    }
+    start += p->deadzone;
+    peak_values[j] = 0;
+    for (int k = start; k < end; k++) {
+      if (corr[k] > peak_values[j]) {
+        peak_values[j]  = corr[k];
+        peak_offsets[j] = k - start;
+        if (peak_values[j] > max_peak) {
+          max_peak = peak_values[j];
+        }
+      }
+    }
+  }
+  return max_peak;
+}
+
 // This function carries out the main processing on the incomming PRACH signal
 int srsran_prach_process(srsran_prach_t* p,
                          cf_t*           signal,
@@ -879,7 +922,6 @@ int srsran_prach_process(srsran_prach_t* p,
 {
   float max_to_cancel = 0;
   cancellation_idx    = -1;
-  int max_idx         = 0;
   srsran_vec_cf_zero(p->cross, p->N_zc);
   srsran_vec_cf_zero(p->corr_freq, p->N_zc);
   for (int i = 0; i < p->num_ra_preambles; i++) {
@@ -897,34 +939,8 @@ int srsran_prach_process(srsran_prach_t* p,
 
     float corr_ave = srsran_vec_acc_ff(p->corr, p->N_zc) / p->N_zc;
 
-    uint32_t winsize = 0;
-    if (p->N_cs != 0) {
-      winsize = p->N_cs;
-    } else {
-      winsize = p->N_zc;
-    }
-    uint32_t n_wins = p->N_zc / winsize;
-
-    float max_peak = 0;
-    for (int j = 0; j < n_wins; j++) {
-      uint32_t start = (p->N_zc - (j * p->N_cs)) % p->N_zc;
-      uint32_t end   = start + winsize;
-      if (end > p->deadzone) {
-        end -= p->deadzone;
-      }
-      start += p->deadzone;
-      p->peak_values[j] = 0;
-      for (int k = start; k < end; k++) {
-        if (p->corr[k] > p->peak_values[j]) {
-          p->peak_values[j]  = p->corr[k];
-          p->peak_offsets[j] = k - start;
-          if (p->peak_values[j] > max_peak) {
-            max_peak = p->peak_values[j];
-            max_idx  = k;
-          }
-        }
-      }
-    }
+    uint32_t n_wins   = prach_nof_windows(p);
+    float    max_peak = prach_find_peaks(p, p->corr, p->peak_values, p->peak_offsets);
     if (max_peak > (p->detect_factor * corr_ave)) {
       for (int j = 0; j < n_wins; j++) {
         if (p->peak_values[j] > p->detect_factor * corr_ave) {
@@ -966,6 +982,23 @@ int srsran_prach_process(srsran_prach_t* p,
   return 0;
 }
 
+// Transforms the received signal and extracts the PRACH bins, returns the index of the first bin
+static uint32_t prach_extract_bins(srsran_prach_t* p, uint32_t freq_offset, cf_t* signal)
+{
+  // FFT incoming signal
+  srsran_dft_run(&p->fft, signal, p->signal_fft);
+
+  // Extract bins of interest
+  uint32_t N_rb_ul = srsran_nof_prb(p->N_ifft_ul);
+  uint32_t k_0     = freq_offset * N_RB_SC - N_rb_ul * N_RB_SC / 2 + p->N_ifft_ul / 2;
+  uint32_t K       = DELTA_F / DELTA_F_RA;
+  uint32_t begin   = PHI + (K * k_0) + (p->is_nr ? 0 : (K / 2));
+
+  memcpy(p->prach_bins, &p->signal_fft[begin], p->N_zc * sizeof(cf_t));
+
+  return begin;
+}
+
 int srsran_prach_detect_offset(srsran_prach_t* p,
                                uint32_t        freq_offset,
                                cf_t*           signal,
@@ -981,22 +1014,26 @@ int srsran_prach_detect_offset(srsran_prach_t* p,
       ERROR("srsran_prach_detect: Signal length is %d and should be %d", sig_len, p->N_ifft_prach);
       return SRSRAN_ERROR_INVALID_INPUTS;
     }
+
+    // Without successive cancellation all the roots are independent and they are correlated in one batch
+    if (!p->successive_cancellation) {
+      ret = srsran_prach_detect_batch_prepare(p, freq_offset, signal, sig_len);
+      for (uint32_t b = 0; b < p->nof_batches && ret == SRSRAN_SUCCESS; b++) {
+        ret = srsran_prach_detect_batch_run(p, b);
+      }
+      if (ret == SRSRAN_SUCCESS) {
+        ret = srsran_prach_detect_batch_collect(p, indices, t_offsets, peak_to_avg, n_indices);
+      }
+      return ret;
+    }
+
     int cancellation_idx = -2;
     bzero(&p->prach_cancel, sizeof(srsran_prach_cancellation_t));
 
-    // FFT incoming signal
-    srsran_dft_run(&p->fft, signal, p->signal_fft);
-
     *n_indices = 0;
 
-    // Extract bins of interest
-    uint32_t N_rb_ul = srsran_nof_prb(p->N_ifft_ul);
-    uint32_t k_0     = freq_offset * N_RB_SC - N_rb_ul * N_RB_SC / 2 + p->N_ifft_ul / 2;
-    uint32_t K       = DELTA_F / DELTA_F_RA;
-    uint32_t begin   = PHI + (K * k_0) + (p->is_nr ? 0 : (K / 2));
-
-    memcpy(p->prach_bins, &p->signal_fft[begin], p->N_zc * sizeof(cf_t));
-    int loops = (p->successive_cancellation) ? SUCCESSIVE_CANCELLATION_ITS : 1;
+    uint32_t begin = prach_extract_bins(p, freq_offset, signal);
+    int      loops = (p->successive_cancellation) ? SUCCESSIVE_CANCELLATION_ITS : 1;
     // if successive cancellation is enabled, we perform the entire search process p->num_ra_preambles times, removing
     // the highest power PRACH preamble each time.
     for (int l = 0; l < loops; l++) {
@@ -1011,6 +1048,158 @@ int srsran_prach_detect_offset(srsran_prach_t* p,
   return ret;
 }
 
+static void prach_batch_free_plans(srsran_prach_t* p)
+{
+  for (uint32_t b = 0; b < SRSRAN_PRACH_MAX_BATCHES; b++) {
+    srsran_dft_plan_free(&p->batch_ifft[b]);
+  }
+}
+
+// Copies the precoded DFT of the roots one after the other and creates one IFFT plan for all the roots of each group
+static int prach_batch_init(srsran_prach_t* p)
+{
+  uint32_t nof_roots   = p->num_ra_preambles;
+  uint32_t nof_batches = SRSRAN_MIN(p->nof_batches, nof_roots);
+
+  if (!p->batch_root_specs) {
+    p->batch_root_specs = srsran_vec_cf_malloc(N_SEQS * SRSRAN_PRACH_N_ZC_LONG);
+    p->batch_corr_spec  = srsran_vec_cf_malloc(N_SEQS * SRSRAN_PRACH_N_ZC_LONG);
+    p->batch_corr       = srsran_vec_f_malloc(N_SEQS * SRSRAN_PRACH_N_ZC_LONG);
+    if (!p->batch_root_specs || !p->batch_corr_spec || !p->batch_corr) {
+      ERROR("Error allocating memory");
+      return SRSRAN_ERROR;
+    }
+  }
+
+  prach_batch_free_plans(p);
+
+  for (uint32_t i = 0; i < nof_roots; i++) {
+    srsran_vec_cf_copy(&p->batch_root_specs[i * p->N_zc], get_precoded_dft(p, p->root_seqs_idx[i]), p->N_zc);
+  }
+
+  // The roots are split as evenly as possible, the groups beyond nof_batches are empty
+  for (uint32_t b = 0; b <= SRSRAN_PRACH_MAX_BATCHES; b++) {
+    p->batch_root_idx[b] = (SRSRAN_MIN(b, nof_batches) * nof_roots) / nof_batches;
+  }
+
+  for (uint32_t b = 0; b < nof_batches; b++) {
+    uint32_t r0 = p->batch_root_idx[b];
+    uint32_t r1 = p->batch_root_idx[b + 1];
+    cf_t*    x  = &p->batch_corr_spec[r0 * p->N_zc];
+    if (srsran_dft_plan_guru_c(
+            &p->batch_ifft[b], p->N_zc, SRSRAN_DFT_BACKWARD, x, x, 1, 1, r1 - r0, p->N_zc, p->N_zc)) {
+      ERROR("Error creating DFT plan");
+      return SRSRAN_ERROR;
+    }
+  }
+
+  p->batch_ready = true;
+  return SRSRAN_SUCCESS;
+}
+
+int srsran_prach_set_nof_batches(srsran_prach_t* p, uint32_t nof_batches)
+{
+  if (p == NULL || nof_batches == 0 || nof_batches > SRSRAN_PRACH_MAX_BATCHES) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+  if (p->nof_batches != nof_batches) {
+    p->nof_batches = nof_batches;
+    p->batch_ready = false;
+  }
+  return SRSRAN_SUCCESS;
+}
+
+int srsran_prach_detect_batch_prepare(srsran_prach_t* p, uint32_t freq_offset, cf_t* signal, uint32_t sig_len)
+{
+  if (p == NULL || signal == NULL || sig_len == 0) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+  if (sig_len < p->N_ifft_prach) {
+    ERROR("srsran_prach_detect: Signal length is %d and should be %d", sig_len, p->N_ifft_prach);
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  if (!p->batch_ready && prach_batch_init(p) < SRSRAN_SUCCESS) {
+    return SRSRAN_ERROR;
+  }
+
+  prach_extract_bins(p, freq_offset, signal);
+
+  return SRSRAN_SUCCESS;
+}
+
+int srsran_prach_detect_batch_run(srsran_prach_t* p, uint32_t batch_idx)
+{
+  if (p == NULL || batch_idx >= SRSRAN_PRACH_MAX_BATCHES || !p->batch_ready) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  uint32_t r0 = p->batch_root_idx[batch_idx];
+  uint32_t r1 = p->batch_root_idx[batch_idx + 1];
+  if (r0 == r1) {
+    return SRSRAN_SUCCESS;
+  }
+
+  // Multiply the received bins by every root of the group, then transform all of them at once
+  cf_t* corr_spec = &p->batch_corr_spec[r0 * p->N_zc];
+  for (uint32_t r = r0; r < r1; r++) {
+    cf_t* x = &p->batch_corr_spec[r * p->N_zc];
+    srsran_vec_prod_conj_ccc(p->prach_bins, &p->batch_root_specs[r * p->N_zc], x, p->N_zc);
+    if (p->freq_domain_offset_calc) {
+      p->batch_cross[r] = srsran_vec_dot_prod_conj_ccc(x, &x[1], p->N_zc - 1);
+    }
+  }
+  srsran_dft_run_guru_c(&p->batch_ifft[batch_idx]);
+
+  float* corr = &p->batch_corr[r0 * p->N_zc];
+  srsran_vec_abs_square_cf(corr_spec, corr, (r1 - r0) * p->N_zc);
+
+  for (uint32_t r = r0; r < r1; r++) {
+    const float* x       = &p->batch_corr[r * p->N_zc];
+    p->batch_corr_ave[r] = srsran_vec_acc_ff(x, p->N_zc) / p->N_zc;
+    p->batch_max_peak[r] = prach_find_peaks(p, x, p->batch_peak_values[r], p->batch_peak_offsets[r]);
+  }
+
+  return SRSRAN_SUCCESS;
+}
+
+int srsran_prach_detect_batch_collect(srsran_prach_t* p,
+                                      uint32_t*       indices,
+                                      float*          t_offsets,
+                                      float*          peak_to_avg,
+                                      uint32_t*       n_indices)
+{
+  if (p == NULL || indices == NULL || n_indices == NULL || !p->batch_ready) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  uint32_t n_wins = prach_nof_windows(p);
+
+  *n_indices = 0;
+  for (uint32_t i = 0; i < p->num_ra_preambles; i++) {
+    float threshold = p->detect_factor * p->batch_corr_ave[i];
+    if (p->batch_max_peak[i] <= threshold) {
+      continue;
+    }
+    for (uint32_t j = 0; j < n_wins; j++) {
+      if (p->batch_peak_values[i][j] > threshold) {
+        indices[*n_indices] = (i * n_wins) + j;
+        if (peak_to_avg) {
+          peak_to_avg[*n_indices] = p->batch_peak_values[i][j] / p->batch_corr_ave[i];
+        }
+        if (t_offsets) {
+          t_offsets[*n_indices] = (p->freq_domain_offset_calc)
+                                      ? prach_time_offset_secs_from_cross(p, p->batch_cross[i])
+                                      : (float)p->batch_peak_offsets[i][j] / (float)(DELTA_F_RA * p->N_zc);
+        }
+        (*n_indices)++;
+      }
+    }
+  }
+
+  return SRSRAN_SUCCESS;
+}
+
 int srsran_prach_free(srsran_prach_t* p)
 {
   free(p->prach_bins);
@@ -1024,6 +1213,16 @@ int srsran_prach_free(srsran_prach_t* p)
   srsran_dft_plan_free(&p->fft);
   srsran_dft_plan_free(&p->zc_fft);
   srsran_dft_plan_free(&p->zc_ifft);
+  prach_batch_free_plans(p);
+  if (p->batch_root_specs) {
+    free(p->batch_root_specs);
+  }
+  if (p->batch_corr_spec) {
+    free(p->batch_corr_spec);
+  }
+  if (p->batch_corr) {
+    free(p->batch_corr);
+  }
 
   if (p->signal_fft) {
     free(p->signal_fft);
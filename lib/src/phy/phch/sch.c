@@ -374,6 +374,8 @@ bool decode_tb_cb(srsran_sch_t*           q,
                   uint32_t                Qm,
                   uint32_t                rv,
                   uint32_t                nof_e_bits,
+                  srsran_sch_llr_source_t llr_source,
+                  void*                   llr_source_arg,
                   void*                   e_bits,
                   uint8_t*                data)
 {
@@ -387,23 +389,33 @@ bool decode_tb_cb(srsran_sch_t*           q,
 
   q->avg_iterations = 0;
 
+  // End of the previous code block input bits
+  uint32_t e_end = 0;
+
   for (int cb_idx = 0; cb_idx < cb_segm->C; cb_idx++) {
+    uint32_t Gp    = nof_e_bits / Qm;
+    uint32_t gamma = cb_segm->C > 0 ? Gp % cb_segm->C : Gp;
+    uint32_t n_e   = Qm * (Gp / cb_segm->C);
+
+    uint32_t rp   = cb_idx * n_e;
+    uint32_t n_e2 = n_e;
+
+    if (cb_idx > cb_segm->C - gamma) {
+      n_e2 = n_e + Qm;
+      rp   = (cb_segm->C - gamma) * n_e + (cb_idx - (cb_segm->C - gamma)) * n_e2;
+    }
+
     /* Do not process blocks with CRC Ok */
     if (softbuffer->cb_crc[cb_idx] == false) {
       uint32_t cb_len     = cb_idx < cb_segm->C1 ? cb_segm->K1 : cb_segm->K2;
       uint32_t cb_len_idx = cb_idx < cb_segm->C1 ? cb_segm->K1_idx : cb_segm->K2_idx;
 
-      uint32_t rlen  = cb_segm->C == 1 ? cb_len : (cb_len - 24);
-      uint32_t Gp    = nof_e_bits / Qm;
-      uint32_t gamma = cb_segm->C > 0 ? Gp % cb_segm->C : Gp;
-      uint32_t n_e   = Qm * (Gp / cb_segm->C);
+      uint32_t rlen = cb_segm->C == 1 ? cb_len : (cb_len - 24);
 
-      uint32_t rp   = cb_idx * n_e;
-      uint32_t n_e2 = n_e;
-
-      if (cb_idx > cb_segm->C - gamma) {
-        n_e2 = n_e + Qm;
-        rp   = (cb_segm->C - gamma) * n_e + (cb_idx - (cb_segm->C - gamma)) * n_e2;
+      // Produce the code block LLR right before the rate dematching, while they are still in cache. The range starts
+      // at the end of the previous code block, so the bits left unused by the segmentation rounding are produced too
+      if (llr_source != NULL) {
+        llr_source(llr_source_arg, e_bits, e_end, rp + n_e2 - e_end);
       }
 
       if (q->llr_is_8bit) {
@@ -471,6 +483,8 @@ bool decode_tb_cb(srsran_sch_t*           q,
       uint32_t rlen   = cb_segm->C == 1 ? cb_len : (cb_len - 24);
       memcpy(&data[cb_idx * rlen / 8], softbuffer->data[cb_idx], rlen / 8 * sizeof(uint8_t));
     }
+
+    e_end = rp + n_e2;
   }
 
   softbuffer->tb_crc = true;
@@ -502,6 +516,9 @@ bool decode_tb_cb(srsran_sch_t*           q,
  * @param[in] e_bits Input transport block
  * @param[in] Qm Modulation type
  * @param[in] rv Redundancy Version. Indicates which part of FEC bits is in input buffer
+ * @param[in] llr_source Optional callback producing each code block input bits right before decoding it, NULL if the
+ * input buffer is already filled
+ * @param[in] llr_source_arg Argument passed to llr_source
  * @param[out] softbuffer Initialized output softbuffer
  * @param[out] data Decoded transport block
  * @return negative if error in parameters or CRC error in decoding
@@ -512,6 +529,8 @@ static int decode_tb(srsran_sch_t*           q,
                      uint32_t                Qm,
                      uint32_t                rv,
                      uint32_t                nof_e_bits,
+                     srsran_sch_llr_source_t llr_source,
+                     void*                   llr_source_arg,
                      int16_t*                e_bits,
                      uint8_t*                data)
 {
@@ -545,7 +564,7 @@ static int decode_tb(srsran_sch_t*           q,
   }
 
   // Process Codeblocks
-  bool cb_crc_ok = decode_tb_cb(q, softbuffer, cb_segm, Qm, rv, nof_e_bits, e_bits, data);
+  bool cb_crc_ok = decode_tb_cb(q, softbuffer, cb_segm, Qm, rv, nof_e_bits, llr_source, llr_source_arg, e_bits, data);
 
   // If any of the CBs CRC is KO
   if (!cb_crc_ok) {
@@ -583,6 +602,18 @@ int srsran_dlsch_decode2(srsran_sch_t*       q,
                          uint8_t*            data,
                          int                 tb_idx,
                          uint32_t            nof_layers)
+{
+  return srsran_dlsch_decode_stream(q, cfg, NULL, NULL, e_bits, data, tb_idx, nof_layers);
+}
+
+int srsran_dlsch_decode_stream(srsran_sch_t*           q,
+                               srsran_pdsch_cfg_t*     cfg,
+                               srsran_sch_llr_source_t llr_source,
+                               void*                   llr_source_arg,
+                               int16_t*                e_bits,
+                               uint8_t*                data,
+                               int                     tb_idx,
+                               uint32_t                nof_layers)
 {
   uint32_t Nl = 1;
 
@@ -604,6 +635,8 @@ int srsran_dlsch_decode2(srsran_sch_t*       q,
                    Qm * Nl,
                    cfg->grant.tb[tb_idx].rv,
                    cfg->grant.tb[tb_idx].nof_bits,
+                   llr_source,
+                   llr_source_arg,
                    e_bits,
                    data);
 }
@@ -1187,7 +1220,8 @@ int srsran_ulsch_decode(srsran_sch_t*       q,
   // Decode ULSCH
   if (cb_segm.tbs > 0) {
     uint32_t G = nb_q / Qm - Q_prime_ri - Q_prime_cqi;
-    ret        = decode_tb(q, cfg->softbuffers.rx, &cb_segm, Qm, cfg->grant.tb.rv, G * Qm, &g_bits[e_offset], data);
+    ret = decode_tb(
+        q, cfg->softbuffers.rx, &cb_segm, Qm, cfg->grant.tb.rv, G * Qm, NULL, NULL, &g_bits[e_offset], data);
   }
   return ret;
 }
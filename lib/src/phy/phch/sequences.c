@@ -69,6 +69,15 @@ int srsran_sequence_pdsch(srsran_sequence_t* seq, uint16_t rnti, int q, uint32_t
   return srsran_sequence_LTE_pr(seq, len, sequence_pdsch_seed(rnti, q, nslot, cell_id));
 }
 
+void srsran_sequence_pdsch_state_init(srsran_sequence_state_t* s,
+                                      uint16_t                 rnti,
+                                      int                      q,
+                                      uint32_t                 nslot,
+                                      uint32_t                 cell_id)
+{
+  srsran_sequence_state_init(s, sequence_pdsch_seed(rnti, q, nslot, cell_id));
+}
+
 void srsran_sequence_pdsch_apply_pack(const uint8_t* in,
                                       uint8_t*       out,
                                       uint16_t       rnti,
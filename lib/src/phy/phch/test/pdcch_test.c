@@ -201,6 +201,7 @@ static int test_case1()
     uint64_t            t_llr_us               = 0;
     uint64_t            t_decode_us            = 0;
     uint64_t            t_decode_count         = 0;
+    uint64_t            t_batch_us             = 0;
     uint32_t            false_alarm_corr_count = 0;
     float               min_corr               = INFINITY;
 
@@ -261,6 +262,24 @@ static int test_case1()
         get_time_interval(t);
         t_llr_us += (size_t)(t[0].tv_sec * 1e6 + t[0].tv_usec);
 
+        // Decode all the candidates in a single call, every one must match its individual decoding below
+        srsran_dci_msg_t  dci_batch[SRSRAN_MAX_CANDIDATES] = {};
+        srsran_dci_msg_t* dci_batch_ptr[SRSRAN_MAX_CANDIDATES];
+        uint32_t          dci_batch_count = 0;
+        for (uint32_t loc_rx = 0; loc_rx < locations_count; loc_rx++) {
+          dci_batch[loc_rx].location = locations[loc_rx];
+          dci_batch[loc_rx].format   = format;
+          if ((false_check || loc_rx == loc) && locations[loc_rx].L >= locations[loc].L) {
+            dci_batch_ptr[dci_batch_count++] = &dci_batch[loc_rx];
+          }
+        }
+        gettimeofday(&t[1], NULL);
+        TESTASSERT(srsran_pdcch_decode_msg_batch(&pdcch_rx, &dl_sf_cfg, &dci_cfg, dci_batch_ptr, dci_batch_count) ==
+                   SRSRAN_SUCCESS);
+        gettimeofday(&t[2], NULL);
+        get_time_interval(t);
+        t_batch_us += (size_t)(t[0].tv_sec * 1e6 + t[0].tv_usec);
+
         // Try decoding the PDCCH in all possible locations
         for (uint32_t loc_rx = 0; loc_rx < locations_count; loc_rx++) {
           // Skip location if:
@@ -283,6 +302,11 @@ static int test_case1()
           t_decode_us += (size_t)(t[0].tv_sec * 1e6 + t[0].tv_usec);
           t_decode_count++;
 
+          TESTASSERT(dci_batch[loc_rx].rnti == dci_rx.rnti);
+          TESTASSERT(dci_batch[loc_rx].format == dci_rx.format);
+          TESTASSERT(dci_batch[loc_rx].nof_bits == dci_rx.nof_bits);
+          TESTASSERT(memcmp(dci_batch[loc_rx].payload, dci_rx.payload, dci_rx.nof_bits) == 0);
+
           // Compute LLR correlation
           float corr = srsran_pdcch_msg_corr(&pdcch_rx, &dci_rx);
 
@@ -334,12 +358,13 @@ static int test_case1()
       return SRSRAN_ERROR;
     }
 
-    printf("test_case_1 - format %s - passed - %.1f usec/encode; %.1f usec/llr; %.1f usec/decode; min_corr=%f; "
-           "false_alarm_prob=%f;\n",
+    printf("test_case_1 - format %s - passed - %.1f usec/encode; %.1f usec/llr; %.1f usec/decode; %.1f usec/batch "
+           "decode; min_corr=%f; false_alarm_prob=%f;\n",
            srsran_dci_format_string(format),
            (double)t_encode_us / (double)(t_encode_count),
            (double)t_llr_us / (double)(t_encode_count),
            (double)t_decode_us / (double)(t_decode_count),
+           (double)t_batch_us / (double)(t_decode_count),
            min_corr,
            (double)false_alarm_corr_count / (double)t_decode_count);
   }
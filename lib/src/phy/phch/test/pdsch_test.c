@@ -55,10 +55,11 @@ static char*       input_file                   = NULL;
 static int         M                            = 1;
 static bool        enable_256qam                = false;
 static bool        use_8_bit                    = false;
+static bool        harq_retx                    = false;
 
 void usage(char* prog)
 {
-  printf("Usage: %s [fmMbcsrtRFpnwav] \n", prog);
+  printf("Usage: %s [fmMbcsrtRFpnwavH] \n", prog);
   printf("\t-f read signal from file [Default generate it with pdsch_encode()]\n");
   printf("\t-m MCS [Default %d]\n", mcs[0]);
   printf("\t-M MCS2 [Default %d]\n", mcs[1]);
@@ -76,6 +77,7 @@ void usage(char* prog)
   printf("\t-p pmi (multiplex only)  [Default %d]\n", pmi);
   printf("\t-w Swap Transport Blocks\n");
   printf("\t-j Enable PDSCH decoder coworker\n");
+  printf("\t-H Decode a retransmission with some code blocks already decoded\n");
   printf("\t-v [set srsran_verbose to debug, default none]\n");
   printf("\t-q Enable/Disable 256QAM modulation (default %s)\n", enable_256qam ? "enabled" : "disabled");
 }
@@ -83,7 +85,7 @@ void usage(char* prog)
 void parse_args(int argc, char** argv)
 {
   int opt;
-  while ((opt = getopt(argc, argv, "fmMcsbrtRFpnqawvXxj")) != -1) {
+  while ((opt = getopt(argc, argv, "fmMcsbrtRFpnqawvXxjH")) != -1) {
     switch (opt) {
       case 'f':
         input_file = argv[optind];
@@ -136,6 +138,9 @@ void parse_args(int argc, char** argv)
       case 'j':
         enable_coworker = true;
         break;
+      case 'H':
+        harq_retx = true;
+        break;
       case 'v':
         increase_srsran_verbose_level();
         break;
@@ -158,15 +163,7 @@ static int check_softbits(srsran_pdsch_t*     pdsch_enb,
   int ret = SRSRAN_SUCCESS;
 
   if (!pdsch_ue->llr_is_8bit && !tb_cw_swap) {
-    // Scramble
-    srsran_sequence_pdsch_apply_s(pdsch_ue->e[tb],
-                                  pdsch_ue->e[tb],
-                                  rnti,
-                                  pdsch_cfg->grant.tb[tb].cw_idx,
-                                  2 * (sf_idx % 10),
-                                  cell.id,
-                                  pdsch_cfg->grant.tb[tb].nof_bits);
-
+    // The encoder scrambles on the fly while modulating, so both buffers hold unscrambled bits
     int16_t* rx       = pdsch_ue->e[tb];
     uint8_t* rx_bytes = pdsch_ue->e[tb];
     for (int i = 0, k = 0; i < pdsch_cfg->grant.tb[tb].nof_bits / 8; i++) {
@@ -187,6 +184,79 @@ static int check_softbits(srsran_pdsch_t*     pdsch_enb,
   return ret;
 }
 
+/* Decodes a retransmission in which every other code block already passed the CRC: the softbuffer holds the data of
+ * those code blocks, taken from a first decoding, and the decoder shall skip them while still descrambling the other
+ * code blocks with the right part of the sequence */
+static int test_harq_retx(srsran_pdsch_t*        pdsch_ue,
+                          srsran_dl_sf_cfg_t*    dl_sf,
+                          srsran_pdsch_cfg_t*    pdsch_cfg,
+                          srsran_chest_dl_res_t* chest_res,
+                          cf_t*                  rx_slot_symbols[SRSRAN_MAX_PORTS],
+                          uint8_t*               data_tx[SRSRAN_MAX_CODEWORDS],
+                          srsran_pdsch_res_t     pdsch_res[SRSRAN_MAX_CODEWORDS])
+{
+  // First decoding, provides the code blocks data
+  for (uint32_t tb = 0; tb < SRSRAN_MAX_CODEWORDS; tb++) {
+    if (pdsch_cfg->grant.tb[tb].enabled) {
+      srsran_softbuffer_rx_reset_tbs(pdsch_cfg->softbuffers.rx[tb], (uint32_t)pdsch_cfg->grant.tb[tb].tbs);
+      pdsch_res[tb].crc = false;
+    }
+  }
+
+  if (srsran_pdsch_decode(pdsch_ue, dl_sf, pdsch_cfg, chest_res, rx_slot_symbols, pdsch_res)) {
+    ERROR("Error decoding PDSCH");
+    return SRSRAN_ERROR;
+  }
+
+  // Keep every other code block as decoded in the softbuffer
+  for (uint32_t tb = 0; tb < SRSRAN_MAX_CODEWORDS; tb++) {
+    if (pdsch_cfg->grant.tb[tb].enabled) {
+      srsran_softbuffer_rx_t* softbuffer = pdsch_cfg->softbuffers.rx[tb];
+      srsran_cbsegm_t         cb_segm    = {};
+      if (srsran_cbsegm(&cb_segm, (uint32_t)pdsch_cfg->grant.tb[tb].tbs) < SRSRAN_SUCCESS) {
+        ERROR("Error computing code block segmentation");
+        return SRSRAN_ERROR;
+      }
+
+      if (!pdsch_res[tb].crc || cb_segm.C < 2) {
+        ERROR("TB%d: Expected a successful first decoding of several code blocks (crc=%d, C=%d)",
+              tb,
+              pdsch_res[tb].crc,
+              cb_segm.C);
+        return SRSRAN_ERROR;
+      }
+
+      srsran_softbuffer_rx_reset_tbs(softbuffer, (uint32_t)pdsch_cfg->grant.tb[tb].tbs);
+      for (uint32_t i = 0; i < cb_segm.C; i += 2) {
+        uint32_t cb_len = i < cb_segm.C1 ? cb_segm.K1 : cb_segm.K2;
+        uint32_t rlen   = cb_len - 24;
+        memcpy(softbuffer->data[i], &pdsch_res[tb].payload[i * rlen / 8], rlen / 8);
+        softbuffer->cb_crc[i] = true;
+      }
+      srsran_vec_u8_zero(pdsch_res[tb].payload, (uint32_t)pdsch_cfg->grant.tb[tb].tbs / 8);
+      pdsch_res[tb].crc = false;
+    }
+  }
+
+  if (srsran_pdsch_decode(pdsch_ue, dl_sf, pdsch_cfg, chest_res, rx_slot_symbols, pdsch_res)) {
+    ERROR("Error decoding PDSCH");
+    return SRSRAN_ERROR;
+  }
+
+  for (uint32_t tb = 0; tb < SRSRAN_MAX_CODEWORDS; tb++) {
+    if (pdsch_cfg->grant.tb[tb].enabled) {
+      if (!pdsch_res[tb].crc ||
+          memcmp(data_tx[tb], pdsch_res[tb].payload, (size_t)pdsch_cfg->grant.tb[tb].tbs / 8) != 0) {
+        ERROR("TB%d: Retransmission failed (crc=%d)", tb, pdsch_res[tb].crc);
+        return SRSRAN_ERROR;
+      }
+    }
+  }
+
+  printf("HARQ retransmission OK\n");
+  return SRSRAN_SUCCESS;
+}
+
 int main(int argc, char** argv)
 {
   int                     ret  = -1;
@@ -491,6 +561,10 @@ int main(int argc, char** argv)
     pdsch_res[i].payload        = data_rx[i];
   }
 
+  if (harq_retx && test_harq_retx(&pdsch_rx, &dl_sf, &pdsch_cfg, &chest_res, rx_slot_symbols, data_tx, pdsch_res)) {
+    goto quit;
+  }
+
   gettimeofday(&t[1], NULL);
   for (uint32_t k = 0; k < M; k++) {
     for (uint32_t i = 0; i < SRSRAN_MAX_CODEWORDS; i++) {
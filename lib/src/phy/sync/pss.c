@@ -161,6 +161,14 @@ int srsran_pss_init_fft_offset_decim(srsran_pss_t* q,
       goto clean_and_exit;
     }
     srsran_vec_f_zero(q->conv_output_avg, buffer_size);
+    for (N_id_2 = 0; N_id_2 < 3; N_id_2++) {
+      q->conv_output_avg_all[N_id_2] = srsran_vec_f_malloc(buffer_size);
+      if (!q->conv_output_avg_all[N_id_2]) {
+        ERROR("Error allocating memory");
+        goto clean_and_exit;
+      }
+      srsran_vec_f_zero(q->conv_output_avg_all[N_id_2], buffer_size);
+    }
 #ifdef SRSRAN_PSS_ACCUMULATE_ABS
     q->conv_output_abs = srsran_vec_f_malloc(buffer_size);
     if (!q->conv_output_abs) {
@@ -297,6 +305,9 @@ void srsran_pss_free(srsran_pss_t* q)
       if (q->pss_signal_freq_full[i]) {
         free(q->pss_signal_freq_full[i]);
       }
+      if (q->conv_output_avg_all[i]) {
+        free(q->conv_output_avg_all[i]);
+      }
     }
 #ifdef CONVOLUTION_FFT
     srsran_conv_fft_cc_free(&q->conv_fft);
@@ -332,6 +343,11 @@ void srsran_pss_reset(srsran_pss_t* q)
 {
   uint32_t buffer_size = q->fft_size + q->frame_size + 1;
   srsran_vec_f_zero(q->conv_output_avg, buffer_size);
+  for (uint32_t N_id_2 = 0; N_id_2 < 3; N_id_2++) {
+    if (q->conv_output_avg_all[N_id_2]) {
+      srsran_vec_f_zero(q->conv_output_avg_all[N_id_2], buffer_size);
+    }
+  }
 }
 
 /**
@@ -405,18 +421,18 @@ void srsran_pss_set_ema_alpha(srsran_pss_t* q, float alpha)
   q->ema_alpha = alpha;
 }
 
-float compute_peak_sidelobe(srsran_pss_t* q, uint32_t corr_peak_pos, uint32_t conv_output_len)
+static float peak_sidelobe(const float* corr, uint32_t corr_peak_pos, uint32_t conv_output_len)
 {
   // Find end of peak lobe to the right
   int pl_ub = corr_peak_pos + 1;
-  while (q->conv_output_avg[pl_ub + 1] <= q->conv_output_avg[pl_ub] && pl_ub < conv_output_len) {
+  while (corr[pl_ub + 1] <= corr[pl_ub] && pl_ub < conv_output_len) {
     pl_ub++;
   }
   // Find end of peak lobe to the left
   int pl_lb;
   if (corr_peak_pos > 2) {
     pl_lb = corr_peak_pos - 1;
-    while (q->conv_output_avg[pl_lb - 1] <= q->conv_output_avg[pl_lb] && pl_lb > 1) {
+    while (corr[pl_lb - 1] <= corr[pl_lb] && pl_lb > 1) {
       pl_lb--;
     }
   } else {
@@ -429,11 +445,36 @@ float compute_peak_sidelobe(srsran_pss_t* q, uint32_t corr_peak_pos, uint32_t co
   }
   int sl_distance_left = pl_lb;
 
-  int   sl_right        = pl_ub + srsran_vec_max_fi(&q->conv_output_avg[pl_ub], sl_distance_right);
-  int   sl_left         = srsran_vec_max_fi(q->conv_output_avg, sl_distance_left);
-  float side_lobe_value = SRSRAN_MAX(q->conv_output_avg[sl_right], q->conv_output_avg[sl_left]);
+  int   sl_right        = pl_ub + srsran_vec_max_fi(&corr[pl_ub], sl_distance_right);
+  int   sl_left         = srsran_vec_max_fi(corr, sl_distance_left);
+  float side_lobe_value = SRSRAN_MAX(corr[sl_right], corr[sl_left]);
 
-  return q->conv_output_avg[corr_peak_pos] / side_lobe_value;
+  return corr[corr_peak_pos] / side_lobe_value;
+}
+
+float compute_peak_sidelobe(srsran_pss_t* q, uint32_t corr_peak_pos, uint32_t conv_output_len)
+{
+  return peak_sidelobe(q->conv_output_avg, corr_peak_pos, conv_output_len);
+}
+
+/* Averages the correlation power with the previous calls and returns the position of the peak */
+static uint32_t pss_accumulate_peak(srsran_pss_t* q, float* corr_avg, uint32_t conv_output_len)
+{
+  // Compute modulus square
+  srsran_vec_abs_square_cf(q->conv_output, q->conv_output_abs, conv_output_len - 1);
+
+  // If enabled, average the absolute value from previous calls
+  if (q->ema_alpha < 1.0 && q->ema_alpha > 0.0) {
+    srsran_vec_sc_prod_fff(q->conv_output_abs, q->ema_alpha, q->conv_output_abs, conv_output_len - 1);
+    srsran_vec_sc_prod_fff(corr_avg, 1 - q->ema_alpha, corr_avg, conv_output_len - 1);
+
+    srsran_vec_sum_fff(q->conv_output_abs, corr_avg, corr_avg, conv_output_len - 1);
+  } else {
+    memcpy(corr_avg, q->conv_output_abs, sizeof(float) * (conv_output_len - 1));
+  }
+
+  /* Find maximum of the absolute value of the correlation */
+  return srsran_vec_max_fi(corr_avg, conv_output_len - 1);
 }
 
 /** Performs time-domain PSS correlation.
@@ -489,21 +530,7 @@ int srsran_pss_find_pss(srsran_pss_t* q, const cf_t* input, float* corr_peak_val
       conv_output_len = q->frame_size;
     }
 
-    // Compute modulus square
-    srsran_vec_abs_square_cf(q->conv_output, q->conv_output_abs, conv_output_len - 1);
-
-    // If enabled, average the absolute value from previous calls
-    if (q->ema_alpha < 1.0 && q->ema_alpha > 0.0) {
-      srsran_vec_sc_prod_fff(q->conv_output_abs, q->ema_alpha, q->conv_output_abs, conv_output_len - 1);
-      srsran_vec_sc_prod_fff(q->conv_output_avg, 1 - q->ema_alpha, q->conv_output_avg, conv_output_len - 1);
-
-      srsran_vec_sum_fff(q->conv_output_abs, q->conv_output_avg, q->conv_output_avg, conv_output_len - 1);
-    } else {
-      memcpy(q->conv_output_avg, q->conv_output_abs, sizeof(float) * (conv_output_len - 1));
-    }
-
-    /* Find maximum of the absolute value of the correlation */
-    corr_peak_pos = srsran_vec_max_fi(q->conv_output_avg, conv_output_len - 1);
+    corr_peak_pos = pss_accumulate_peak(q, q->conv_output_avg, conv_output_len);
 
     // save absolute value
     q->peak_value = q->conv_output_avg[corr_peak_pos];
@@ -533,6 +560,74 @@ int srsran_pss_find_pss(srsran_pss_t* q, const cf_t* input, float* corr_peak_val
   return ret;
 }
 
+/** Correlates the input with the three PSS sequences at once, for searching a cell which N_id_2 is unknown.
+ * The input is transformed only once and multiplied by each sequence in the frequency domain, which saves two of the
+ * three input FFTs of calling srsran_pss_find_pss() for each N_id_2.
+ *
+ * The correlation power is averaged across calls independently for each N_id_2, and independently of
+ * srsran_pss_find_pss(). For each N_id_2, the peak position (with the same convention as srsran_pss_find_pss()) is
+ * stored in peak_pos and the peak value (peak to side-lobe ratio if SRSRAN_PSS_RETURN_PSR is defined) in
+ * corr_peak_value.
+ *
+ * Input buffer must be frame_size long and frame_size must not be smaller than fft_size.
+ */
+int srsran_pss_find_pss_all(srsran_pss_t* q, const cf_t* input, int peak_pos[3], float corr_peak_value[3])
+{
+  int ret = SRSRAN_ERROR_INVALID_INPUTS;
+
+  if (q != NULL && input != NULL && peak_pos != NULL && corr_peak_value != NULL) {
+#ifdef CONVOLUTION_FFT
+    if (q->frame_size < q->fft_size) {
+      ERROR("Error finding PSS peaks, frame size %d is smaller than the FFT size %d", q->frame_size, q->fft_size);
+      return SRSRAN_ERROR;
+    }
+
+    const cf_t* conv_input = q->tmp_input;
+    memcpy(q->tmp_input, input, (q->frame_size * q->decimate) * sizeof(cf_t));
+    if (q->decimate > 1) {
+      srsran_filt_decim_cc_execute(&(q->filter),
+                                   q->tmp_input,
+                                   q->filter.downsampled_input,
+                                   q->filter.filter_output,
+                                   (q->frame_size * q->decimate));
+      conv_input = q->filter.filter_output;
+    }
+
+    // Transform the input once for the three sequences
+    srsran_dft_run_c(&q->conv_fft.input_plan, conv_input, q->conv_fft.input_fft);
+    uint32_t conv_output_len = q->conv_fft.output_len - 1;
+
+    for (uint32_t N_id_2 = 0; N_id_2 < 3; N_id_2++) {
+      srsran_vec_prod_ccc(
+          q->conv_fft.input_fft, q->pss_signal_freq_full[N_id_2], q->conv_fft.output_fft, q->conv_fft.output_len);
+      srsran_dft_run_c(&q->conv_fft.output_plan, q->conv_fft.output_fft, q->conv_output);
+
+      float*   corr_avg      = q->conv_output_avg_all[N_id_2];
+      uint32_t corr_peak_pos = pss_accumulate_peak(q, corr_avg, conv_output_len);
+
+#ifdef SRSRAN_PSS_RETURN_PSR
+      corr_peak_value[N_id_2] = peak_sidelobe(corr_avg, corr_peak_pos, conv_output_len);
+#else
+      corr_peak_value[N_id_2] = corr_avg[corr_peak_pos];
+#endif
+
+      if (q->decimate > 1) {
+        int decimation_correction = (q->filter.num_taps - 2);
+        corr_peak_pos             = corr_peak_pos - decimation_correction;
+        corr_peak_pos             = corr_peak_pos * q->decimate;
+      }
+      peak_pos[N_id_2] = (int)corr_peak_pos;
+    }
+
+    ret = SRSRAN_SUCCESS;
+#else
+    ERROR("Error finding PSS peaks, the joint search requires CONVOLUTION_FFT");
+    ret = SRSRAN_ERROR;
+#endif
+  }
+  return ret;
+}
+
 /* Computes frequency-domain channel estimation of the PSS symbol
  * input signal is in the time-domain.
  * ce is the returned frequency-domain channel estimates.
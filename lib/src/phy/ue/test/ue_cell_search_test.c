@@ -0,0 +1,244 @@
+/**
+ * Copyright 2013-2021 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srsran/common/test_common.h"
+#include "srsran/phy/channel/ch_awgn.h"
+#include "srsran/phy/ue/ue_cell_search.h"
+#include "srsran/phy/utils/debug.h"
+#include "srsran/phy/utils/vector.h"
+#include <getopt.h>
+#include <stdlib.h>
+
+static uint32_t cell_id  = 150;
+static float    snr_dB   = 0.0f;
+
+// The stream is a radio frame with PSS and SSS only, repeated forever with fresh noise
+typedef struct {
+  cf_t*    frame;
+  uint32_t frame_len;
+  uint32_t pos;
+  uint32_t nof_read;
+  float    noise_std;
+} stream_t;
+
+static void usage(char* prog)
+{
+  printf("Usage: %s [csv]\n", prog);
+  printf("\t-c cell_id [Default %d]\n", cell_id);
+  printf("\t-s SNR of the PSS in dB [Default %.1f]\n", snr_dB);
+  printf("\t-v [set srsran_verbose to debug, default none]\n");
+}
+
+static void parse_args(int argc, char** argv)
+{
+  int opt;
+  while ((opt = getopt(argc, argv, "csv")) != -1) {
+    switch (opt) {
+      case 'c':
+        cell_id = (uint32_t)strtol(argv[optind], NULL, 10);
+        break;
+      case 's':
+        snr_dB = strtof(argv[optind], NULL);
+        break;
+      case 'v':
+        increase_srsran_verbose_level();
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+}
+
+static int recv_callback(void* h, cf_t* data[SRSRAN_MAX_CHANNELS], uint32_t nsamples, srsran_timestamp_t* t)
+{
+  stream_t* s = (stream_t*)h;
+
+  for (uint32_t i = 0; i < nsamples; i++) {
+    data[0][i] = s->frame[s->pos];
+    s->pos     = (s->pos + 1) % s->frame_len;
+  }
+  srsran_ch_awgn_c(data[0], data[0], s->noise_std, nsamples);
+  s->nof_read += nsamples;
+
+  return (int)nsamples;
+}
+
+/* Generates a radio frame with the PSS and SSS of the given cell and returns the mean power of the PSS symbol */
+static float gen_frame(cf_t* frame, uint32_t pci, uint32_t nof_prb)
+{
+  srsran_ofdm_t ifft;
+  uint32_t      sf_len     = SRSRAN_SF_LEN_PRB(nof_prb);
+  cf_t*         sf_symbols = srsran_vec_cf_malloc(SRSRAN_SF_LEN_RE(nof_prb, SRSRAN_CP_NORM));
+  cf_t          pss_signal[SRSRAN_PSS_LEN];
+  float         sss_signal0[SRSRAN_SSS_LEN];
+  float         sss_signal5[SRSRAN_SSS_LEN];
+
+  srsran_pss_generate(pss_signal, pci % 3);
+  srsran_sss_generate(sss_signal0, sss_signal5, pci);
+
+  srsran_vec_cf_zero(frame, 10 * sf_len);
+  for (uint32_t sf_idx = 0; sf_idx < 10; sf_idx += 5) {
+    // The OFDM initialisation clears the input buffer, so the signals are put afterwards
+    srsran_ofdm_tx_init(&ifft, SRSRAN_CP_NORM, sf_symbols, &frame[sf_idx * sf_len], nof_prb);
+    srsran_pss_put_slot(pss_signal, sf_symbols, nof_prb, SRSRAN_CP_NORM);
+    srsran_sss_put_slot(sf_idx ? sss_signal5 : sss_signal0, sf_symbols, nof_prb, SRSRAN_CP_NORM);
+    srsran_ofdm_tx_sf(&ifft);
+    srsran_ofdm_tx_free(&ifft);
+  }
+  free(sf_symbols);
+
+  // The PSS is the last symbol of the first slot
+  uint32_t symbol_sz = srsran_symbol_sz(nof_prb);
+  uint32_t pss_start = sf_len / 2 - symbol_sz;
+  return srsran_vec_avg_power_cf(&frame[pss_start], symbol_sz);
+}
+
+static int test_scan(stream_t* s, bool prescan, int expected_cell_id)
+{
+  srsran_ue_cellsearch_t        cs;
+  srsran_ue_cellsearch_result_t found_cells[3] = {};
+  uint32_t                      max_N_id_2     = 0;
+
+  TESTASSERT(srsran_ue_cellsearch_init_multi(&cs, 8, recv_callback, 1, s) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_ue_cellsearch_set_nof_valid_frames(&cs, 4) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_ue_cellsearch_set_prescan(&cs, prescan, SRSRAN_CS_PRESCAN_DEFAULT_THRESHOLD) == SRSRAN_SUCCESS);
+
+  s->nof_read = 0;
+  int nof_cells = srsran_ue_cellsearch_scan(&cs, found_cells, &max_N_id_2);
+
+  printf("Scan with%s pre-scan: %d cells, %.1f ms of samples read\n",
+         prescan ? "" : "out",
+         nof_cells,
+         1000.0 * s->nof_read / SRSRAN_CS_SAMP_FREQ);
+
+  if (expected_cell_id < 0) {
+    TESTASSERT(nof_cells == 0);
+  } else {
+    TESTASSERT(nof_cells >= 1);
+    TESTASSERT(max_N_id_2 == expected_cell_id % 3);
+    TESTASSERT(found_cells[max_N_id_2].cell_id == expected_cell_id);
+  }
+
+  srsran_ue_cellsearch_free(&cs);
+  return SRSRAN_SUCCESS;
+}
+
+static int test_wideband()
+{
+  srsran_ue_cellsearch_t cs;
+  stream_t               unused        = {};
+  const uint32_t         nof_prb       = 25;
+  const uint32_t         frame_len     = 10 * SRSRAN_SF_LEN_PRB(nof_prb);
+  const double           wb_srate      = srsran_sampling_freq_hz(nof_prb);
+  const double           offset_hz[3]  = {1.8e6, -1.8e6, 0.0};
+  const uint32_t         pci[2]        = {cell_id, cell_id + 1};
+  float                  psr[3][3]     = {};
+  float                  noise_std     = 0.0f;
+  const uint32_t         nof_samples   = 2 * frame_len;
+  cf_t*                  frame         = srsran_vec_cf_malloc(frame_len);
+  cf_t*                  capture       = srsran_vec_cf_malloc(nof_samples);
+  cf_t*                  shifted       = srsran_vec_cf_malloc(nof_samples);
+
+  TESTASSERT(frame != NULL && capture != NULL && shifted != NULL);
+
+  // Two cells with different N_id_2 on both sides of the capture, nothing in the middle
+  srsran_vec_cf_zero(capture, nof_samples);
+  for (uint32_t c = 0; c < 2; c++) {
+    float pss_power = gen_frame(frame, pci[c], nof_prb);
+    memcpy(shifted, frame, sizeof(cf_t) * frame_len);
+    memcpy(&shifted[frame_len], frame, sizeof(cf_t) * frame_len);
+    srsran_vec_apply_cfo(shifted, (float)(offset_hz[c] / wb_srate), shifted, nof_samples);
+    srsran_vec_sum_ccc(capture, shifted, capture, nof_samples);
+    if (c == 0) {
+      noise_std = sqrtf(pss_power / 2.0f) * srsran_convert_dB_to_amplitude(-snr_dB);
+    }
+  }
+  srsran_ch_awgn_c(capture, capture, noise_std, nof_samples);
+
+  TESTASSERT(srsran_ue_cellsearch_init_multi(&cs, 8, recv_callback, 1, &unused) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_ue_cellsearch_set_prescan(&cs, true, SRSRAN_CS_PRESCAN_DEFAULT_THRESHOLD) == SRSRAN_SUCCESS);
+
+  struct timeval t[3];
+  gettimeofday(&t[1], NULL);
+  TESTASSERT(srsran_ue_cellsearch_prescan_wideband(&cs, capture, nof_samples, wb_srate, offset_hz, 3, psr) ==
+             SRSRAN_SUCCESS);
+  gettimeofday(&t[2], NULL);
+  get_time_interval(t);
+
+  for (uint32_t c = 0; c < 3; c++) {
+    printf("Wideband pre-scan at %+.1f MHz: PSR=(%.2f, %.2f, %.2f)\n",
+           offset_hz[c] / 1e6,
+           psr[c][0],
+           psr[c][1],
+           psr[c][2]);
+  }
+  printf("Wideband pre-scan of %d carriers took %ld usec\n", 3, t[0].tv_sec * 1000000 + t[0].tv_usec);
+
+  for (uint32_t c = 0; c < 2; c++) {
+    for (uint32_t N_id_2 = 0; N_id_2 < 3; N_id_2++) {
+      bool present = (N_id_2 == pci[c] % 3);
+      TESTASSERT(present == (psr[c][N_id_2] >= SRSRAN_CS_PRESCAN_DEFAULT_THRESHOLD));
+    }
+  }
+  for (uint32_t N_id_2 = 0; N_id_2 < 3; N_id_2++) {
+    TESTASSERT(psr[2][N_id_2] < SRSRAN_CS_PRESCAN_DEFAULT_THRESHOLD);
+  }
+
+  srsran_ue_cellsearch_free(&cs);
+  free(frame);
+  free(capture);
+  free(shifted);
+  return SRSRAN_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+  stream_t s = {};
+
+  parse_args(argc, argv);
+
+  s.frame_len = 10 * SRSRAN_SF_LEN_PRB(SRSRAN_CS_NOF_PRB);
+  s.frame     = srsran_vec_cf_malloc(s.frame_len);
+  TESTASSERT(s.frame != NULL);
+
+  float pss_power = gen_frame(s.frame, cell_id, SRSRAN_CS_NOF_PRB);
+  s.noise_std     = sqrtf(pss_power / 2.0f) * srsran_convert_dB_to_amplitude(-snr_dB);
+
+  // The pre-scan must find the same cell reading less samples
+  uint32_t nof_read_full = 0;
+  TESTASSERT(test_scan(&s, false, cell_id) == SRSRAN_SUCCESS);
+  nof_read_full = s.nof_read;
+  TESTASSERT(test_scan(&s, true, cell_id) == SRSRAN_SUCCESS);
+  TESTASSERT(s.nof_read < nof_read_full);
+
+  // Without a cell only the pre-scan runs
+  srsran_vec_cf_zero(s.frame, s.frame_len);
+  TESTASSERT(test_scan(&s, true, -1) == SRSRAN_SUCCESS);
+  TESTASSERT(s.nof_read == SRSRAN_CS_PRESCAN_NOF_BLOCKS * SRSRAN_CS_PRESCAN_BLOCK_LEN);
+
+  TESTASSERT(test_wideband() == SRSRAN_SUCCESS);
+
+  free(s.frame);
+
+  printf("Ok\n");
+  return SRSRAN_SUCCESS;
+}
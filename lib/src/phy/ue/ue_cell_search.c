@@ -173,6 +173,19 @@ void srsran_ue_cellsearch_free(srsran_ue_cellsearch_t* q)
   if (q->mode_ntimes) {
     free(q->mode_ntimes);
   }
+  if (q->prescan_pss.conv_output) {
+    srsran_pss_free(&q->prescan_pss);
+    srsran_dft_plan_free(&q->prescan_nb_ifft);
+  }
+  if (q->prescan_wb_len) {
+    srsran_dft_plan_free(&q->prescan_wb_fft);
+  }
+  if (q->prescan_wb_buffer) {
+    free(q->prescan_wb_buffer);
+  }
+  if (q->prescan_nb_buffer) {
+    free(q->prescan_nb_buffer);
+  }
   srsran_ue_sync_free(&q->ue_sync);
 
   bzero(q, sizeof(srsran_ue_cellsearch_t));
@@ -188,6 +201,162 @@ int srsran_ue_cellsearch_set_nof_valid_frames(srsran_ue_cellsearch_t* q, uint32_
   }
 }
 
+int srsran_ue_cellsearch_set_prescan(srsran_ue_cellsearch_t* q, bool enable, float psr_threshold)
+{
+  if (q == NULL) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  // The correlator and the narrowband buffers are only created the first time the pre-scan is enabled
+  if (enable && q->prescan_pss.conv_output == NULL) {
+    if (srsran_pss_init_fft(&q->prescan_pss, SRSRAN_CS_PRESCAN_WINDOW_LEN, 128)) {
+      ERROR("Error initiating PSS pre-scan");
+      return SRSRAN_ERROR;
+    }
+    srsran_pss_set_ema_alpha(&q->prescan_pss, 0.5f);
+
+    if (srsran_dft_plan_c(&q->prescan_nb_ifft, SRSRAN_CS_PRESCAN_WINDOW_LEN, SRSRAN_DFT_BACKWARD)) {
+      ERROR("Error creating DFT plan");
+      srsran_pss_free(&q->prescan_pss);
+      return SRSRAN_ERROR;
+    }
+
+    q->prescan_nb_buffer = srsran_vec_cf_malloc(SRSRAN_CS_PRESCAN_WINDOW_LEN);
+    if (!q->prescan_nb_buffer) {
+      perror("malloc");
+      return SRSRAN_ERROR;
+    }
+  }
+
+  q->prescan_enable    = enable;
+  q->prescan_threshold = psr_threshold;
+  return SRSRAN_SUCCESS;
+}
+
+int srsran_ue_cellsearch_prescan(srsran_ue_cellsearch_t* q, float psr[3])
+{
+  int   peak_pos[3];
+  cf_t* rx_buffer[SRSRAN_MAX_CHANNELS] = {};
+
+  if (q == NULL || psr == NULL || !q->prescan_enable) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  // Each block is received after the last samples of the previous one, so every window overlaps the previous by an FFT
+  uint32_t overlap = SRSRAN_CS_PRESCAN_WINDOW_LEN - SRSRAN_CS_PRESCAN_BLOCK_LEN;
+  for (uint32_t i = 0; i < q->nof_rx_antennas; i++) {
+    rx_buffer[i] = &q->sf_buffer[i][overlap];
+  }
+  srsran_vec_cf_zero(q->sf_buffer[0], overlap);
+
+  srsran_pss_reset(&q->prescan_pss);
+  for (uint32_t n = 0; n < SRSRAN_CS_PRESCAN_NOF_BLOCKS; n++) {
+    if (q->ue_sync.recv_callback(q->ue_sync.stream, rx_buffer, SRSRAN_CS_PRESCAN_BLOCK_LEN, NULL) < 0) {
+      ERROR("Error receiving samples for the PSS pre-scan");
+      return SRSRAN_ERROR;
+    }
+    if (srsran_pss_find_pss_all(&q->prescan_pss, q->sf_buffer[0], peak_pos, psr) < 0) {
+      return SRSRAN_ERROR;
+    }
+    memmove(q->sf_buffer[0], &q->sf_buffer[0][SRSRAN_CS_PRESCAN_BLOCK_LEN], overlap * sizeof(cf_t));
+  }
+
+  INFO("CELL SEARCH: PSS pre-scan PSR=(%.2f, %.2f, %.2f)", psr[0], psr[1], psr[2]);
+
+  return SRSRAN_SUCCESS;
+}
+
+int srsran_ue_cellsearch_prescan_wideband(srsran_ue_cellsearch_t* q,
+                                          const cf_t*             input,
+                                          uint32_t                nof_samples,
+                                          double                  srate_hz,
+                                          const double*           offset_hz,
+                                          uint32_t                nof_carriers,
+                                          float                   psr[][3])
+{
+  int peak_pos[3];
+
+  if (q == NULL || input == NULL || offset_hz == NULL || psr == NULL || !q->prescan_enable) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  uint32_t ratio = (uint32_t)round(srate_hz / SRSRAN_CS_SAMP_FREQ);
+  if (ratio == 0 || fabs(ratio * SRSRAN_CS_SAMP_FREQ - srate_hz) > 1.0) {
+    ERROR("The capture sampling rate %.2f MHz is not a multiple of %.2f MHz", srate_hz / 1e6, SRSRAN_CS_SAMP_FREQ / 1e6);
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  uint32_t nb_len    = SRSRAN_CS_PRESCAN_WINDOW_LEN;
+  uint32_t wb_len    = ratio * nb_len;
+  uint32_t wb_hop    = ratio * SRSRAN_CS_PRESCAN_BLOCK_LEN;
+  uint32_t nof_block = nof_samples < wb_len ? 0 : 1 + (nof_samples - wb_len) / wb_hop;
+  if (nof_block == 0) {
+    ERROR("The capture is too short, at least %d samples are needed", wb_len);
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  for (uint32_t c = 0; c < nof_carriers; c++) {
+    if (fabs(offset_hz[c]) + SRSRAN_CS_SAMP_FREQ / 2 > srate_hz / 2) {
+      ERROR("Carrier at %+.2f MHz does not fit in the capture", offset_hz[c] / 1e6);
+      return SRSRAN_ERROR_INVALID_INPUTS;
+    }
+  }
+
+  // The wideband transform depends on the sampling rate, it is only planned again when the rate changes
+  if (q->prescan_wb_len != wb_len) {
+    if (q->prescan_wb_len) {
+      srsran_dft_plan_free(&q->prescan_wb_fft);
+      free(q->prescan_wb_buffer);
+      q->prescan_wb_buffer = NULL;
+      q->prescan_wb_len    = 0;
+    }
+    if (srsran_dft_plan_c(&q->prescan_wb_fft, wb_len, SRSRAN_DFT_FORWARD)) {
+      ERROR("Error creating DFT plan");
+      return SRSRAN_ERROR;
+    }
+    q->prescan_wb_len    = wb_len;
+    q->prescan_wb_buffer = srsran_vec_cf_malloc(wb_len);
+    if (!q->prescan_wb_buffer) {
+      perror("malloc");
+      return SRSRAN_ERROR;
+    }
+  }
+
+  for (uint32_t c = 0; c < nof_carriers; c++) {
+    srsran_pss_reset(&q->prescan_pss);
+
+    // Bin of the carrier centre, the bin spacing is the same in the wideband and in the narrowband transforms
+    int32_t k0 = (int32_t)round(offset_hz[c] * nb_len / SRSRAN_CS_SAMP_FREQ);
+
+    for (uint32_t n = 0; n < nof_block; n++) {
+      // The transform of the capture does not depend on the carrier but it is cheaper to recompute it than to keep all
+      // of them when there are few carriers
+      srsran_dft_run_c(&q->prescan_wb_fft, &input[n * wb_hop], q->prescan_wb_buffer);
+
+      // Take the positive frequencies, then the negative ones, around the carrier centre
+      int32_t half = nb_len / 2;
+      for (int32_t j = 0; j < (int32_t)nb_len; j++) {
+        int32_t f                = (j < half) ? j : j - (int32_t)nb_len;
+        int32_t k                = (k0 + f + (int32_t)wb_len) % (int32_t)wb_len;
+        q->prescan_nb_buffer[j] = q->prescan_wb_buffer[k];
+      }
+      srsran_dft_run_c(&q->prescan_nb_ifft, q->prescan_nb_buffer, q->prescan_nb_buffer);
+
+      if (srsran_pss_find_pss_all(&q->prescan_pss, q->prescan_nb_buffer, peak_pos, psr[c]) < 0) {
+        return SRSRAN_ERROR;
+      }
+    }
+
+    INFO("CELL SEARCH: PSS pre-scan at %+.2f MHz PSR=(%.2f, %.2f, %.2f)",
+         offset_hz[c] / 1e6,
+         psr[c][0],
+         psr[c][1],
+         psr[c][2]);
+  }
+
+  return SRSRAN_SUCCESS;
+}
+
 void srsran_set_detect_cp(srsran_ue_cellsearch_t* q, bool enable)
 {
   srsran_ue_sync_cp_en(&q->ue_sync, enable);
@@ -269,8 +438,18 @@ int srsran_ue_cellsearch_scan(srsran_ue_cellsearch_t*       q,
   int      ret                = 0;
   float    max_peak_value     = -1.0;
   uint32_t nof_detected_cells = 0;
+  float    prescan_psr[3]     = {};
+
+  if (q->prescan_enable && srsran_ue_cellsearch_prescan(q, prescan_psr) < SRSRAN_SUCCESS) {
+    ERROR("Error in PSS pre-scan");
+    return SRSRAN_ERROR;
+  }
 
   for (uint32_t N_id_2 = 0; N_id_2 < 3; N_id_2++) {
+    if (q->prescan_enable && prescan_psr[N_id_2] < q->prescan_threshold) {
+      INFO("CELL SEARCH: Skipping scan for N_id_2=%d, pre-scan PSR=%.2f", N_id_2, prescan_psr[N_id_2]);
+      continue;
+    }
     INFO("CELL SEARCH: Starting scan for N_id_2=%d", N_id_2);
     ret = srsran_ue_cellsearch_scan_N_id_2(q, N_id_2, &found_cells[N_id_2]);
     if (ret < 0) {
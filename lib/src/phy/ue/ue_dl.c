@@ -419,11 +419,75 @@ static int dci_blind_search(srsran_ue_dl_t*     q,
                             dci_blind_search_t* search_space,
                             srsran_dci_cfg_t*   dci_cfg,
                             srsran_dci_msg_t    dci_msg[SRSRAN_MAX_DCI_MSG],
-                            bool                search_in_common)
+                            bool                search_in_common,
+                            float               prune_threshold,
+                            bool                audit)
 {
   uint32_t nof_dci = 0;
   if (rnti) {
-    for (int l = 0; l < search_space->nof_locations; l++) {
+    // Pre-screen the candidates by their received energy. They are visited from the strongest to the weakest, so the
+    // CCEs of a detected DCI are excluded before trying weaker overlapping candidates
+    float    llr_mean[SRSRAN_MAX_CANDIDATES];
+    uint32_t order[SRSRAN_MAX_CANDIDATES];
+    float    llr_mean_max = 0.0f;
+    for (uint32_t l = 0; l < search_space->nof_locations; l++) {
+      llr_mean[l]  = srsran_pdcch_location_llr_mean(&q->pdcch, sf, &search_space->loc[l]);
+      llr_mean_max = SRSRAN_MAX(llr_mean_max, llr_mean[l]);
+
+      // Insertion sort, it keeps the search space order for candidates with the same energy
+      uint32_t k = l;
+      for (; k > 0 && llr_mean[order[k - 1]] < llr_mean[l]; k--) {
+        order[k] = order[k - 1];
+      }
+      order[k] = l;
+    }
+    float prune_llr_mean = SRSRAN_MAX(SRSRAN_PDCCH_LLR_MEAN_MIN, prune_threshold * llr_mean_max);
+
+    q->pdcch_stats.nof_searches++;
+    q->pdcch_stats.nof_candidates += search_space->nof_locations * search_space->nof_formats;
+
+    // Empty locations are not decoded by srsran_pdcch_decode_msg() either, weak ones are only decoded when auditing
+    bool     pruned[SRSRAN_MAX_CANDIDATES];
+    uint32_t nof_candidates = 0;
+    for (uint32_t i = 0; i < search_space->nof_locations; i++) {
+      uint32_t l = order[i];
+      pruned[l]  = llr_mean[l] < prune_llr_mean;
+      if (dci_location_is_allocated(q, search_space->loc[l])) {
+        INFO("Skipping location L=%d, ncce=%d. Already allocated", search_space->loc[l].L, search_space->loc[l].ncce);
+        continue;
+      }
+      if (llr_mean[l] <= SRSRAN_PDCCH_LLR_MEAN_MIN || (pruned[l] && !audit)) {
+        INFO("Skipping location L=%d, ncce=%d. Mean LLR %.2f below %.2f",
+             search_space->loc[l].L,
+             search_space->loc[l].ncce,
+             llr_mean[l],
+             prune_llr_mean);
+        continue;
+      }
+      order[nof_candidates++] = l;
+    }
+
+    // Decode the remaining candidates in one call per format. They are checked below in the same order as before, so a
+    // candidate overlapping a DCI found in this search is decoded but then ignored
+    for (uint32_t f = 0; f < search_space->nof_formats; f++) {
+      srsran_dci_msg_t* candidates[SRSRAN_MAX_CANDIDATES];
+      for (uint32_t i = 0; i < nof_candidates; i++) {
+        srsran_dci_msg_t* msg = &q->pdcch_candidates[f][order[i]];
+        msg->location         = search_space->loc[order[i]];
+        msg->format           = search_space->formats[f];
+        msg->rnti             = 0;
+        msg->nof_bits         = 0;
+        candidates[i]         = msg;
+      }
+      if (srsran_pdcch_decode_msg_batch(&q->pdcch, sf, dci_cfg, candidates, nof_candidates)) {
+        ERROR("Error decoding DCI msg");
+        return SRSRAN_ERROR;
+      }
+      q->pdcch_stats.nof_decoded += nof_candidates;
+    }
+
+    for (uint32_t i = 0; i < nof_candidates; i++) {
+      uint32_t l = order[i];
       if (nof_dci >= SRSRAN_MAX_DCI_MSG) {
         ERROR("Can't store more DCIs in buffer");
         return nof_dci;
@@ -432,6 +496,7 @@ static int dci_blind_search(srsran_ue_dl_t*     q,
         INFO("Skipping location L=%d, ncce=%d. Already allocated", search_space->loc[l].L, search_space->loc[l].ncce);
         continue;
       }
+
       for (uint32_t f = 0; f < search_space->nof_formats; f++) {
         INFO("Searching format %s in %d,%d (%d/%d)",
              srsran_dci_format_string(search_space->formats[f]),
@@ -440,14 +505,7 @@ static int dci_blind_search(srsran_ue_dl_t*     q,
              l,
              search_space->nof_locations);
 
-        // Try to decode a valid DCI msg
-        dci_msg[nof_dci].location = search_space->loc[l];
-        dci_msg[nof_dci].format   = search_space->formats[f];
-        dci_msg[nof_dci].rnti     = 0;
-        if (srsran_pdcch_decode_msg(&q->pdcch, sf, dci_cfg, &dci_msg[nof_dci])) {
-          ERROR("Error decoding DCI msg");
-          return SRSRAN_ERROR;
-        }
+        dci_msg[nof_dci] = q->pdcch_candidates[f][l];
 
         // Check if RNTI is matched
         if ((dci_msg[nof_dci].rnti == rnti) && (dci_msg[nof_dci].nof_bits > 0)) {
@@ -460,6 +518,14 @@ static int dci_blind_search(srsran_ue_dl_t*     q,
             continue;
           }
 
+          q->pdcch_stats.nof_dci++;
+          if (audit) {
+            q->pdcch_stats.nof_audit_dci++;
+            if (pruned[l]) {
+              q->pdcch_stats.nof_missed++;
+            }
+          }
+
           // Look for the messages found and apply the new format if the location is common
           if (search_in_common && (dci_cfg->multiple_csi_request_enabled || dci_cfg->srs_request_enabled)) {
             /*
@@ -562,7 +628,11 @@ static int find_dci_ss(srsran_ue_dl_t*            q,
        is_ue ? "ue" : "common",
        dci_cfg.multiple_csi_request_enabled);
 
-  return dci_blind_search(q, sf, rnti, &search_space, &dci_cfg, dci_msg, cfg->cfg.dci_common_ss);
+  // Every audit period, the candidates discarded by the pre-screening are decoded too for measuring its missed DCI
+  bool audit = cfg->pdcch_prune_audit_period > 0 && (q->pdcch_audit_count++ % cfg->pdcch_prune_audit_period) == 0;
+
+  return dci_blind_search(
+      q, sf, rnti, &search_space, &dci_cfg, dci_msg, cfg->cfg.dci_common_ss, cfg->pdcch_prune_threshold, audit);
 }
 
 /*
@@ -45,6 +45,7 @@ static uint32_t mcs                     = 20;
 static int      cross_carrier_indicator = -1;
 static bool     enable_256qam           = false;
 static float    snr_db                  = NAN; // SNR in dB
+static float    pdcch_prune_threshold   = 0.0f;
 
 void usage(char* prog)
 {
@@ -58,6 +59,8 @@ void usage(char* prog)
   printf("\t-t Transmission mode: 1,2,3,4 [Default %d]\n", transmission_mode + 1);
   printf("\t-m mcs [Default %d]\n", mcs);
   printf("\t-S SNR in dB [Default %+.2f]\n", snr_db);
+  printf("\t-P PDCCH candidate pruning threshold, every other search is audited [Default %.2f]\n",
+         pdcch_prune_threshold);
   printf("\tAdvanced parameters:\n");
   if (cross_carrier_indicator >= 0) {
     printf("\t\t-a carrier-indicator [Default %d]\n", cross_carrier_indicator);
@@ -96,7 +99,7 @@ void parse_args(int argc, char** argv)
     nof_rx_ant     = 2;
   }
 
-  while ((opt = getopt(argc, argv, "cfapndvqstmES")) != -1) {
+  while ((opt = getopt(argc, argv, "cfapndvqstmESP")) != -1) {
     switch (opt) {
       case 't':
         transmission_mode = (uint32_t)strtol(argv[optind], NULL, 10) - 1;
@@ -126,6 +129,9 @@ void parse_args(int argc, char** argv)
       case 'S':
         snr_db = strtof(argv[optind], NULL);
         break;
+      case 'P':
+        pdcch_prune_threshold = strtof(argv[optind], NULL);
+        break;
       case 'E':
         cell.cp = ((uint32_t)strtol(argv[optind], NULL, 10)) ? SRSRAN_CP_EXT : SRSRAN_CP_NORM;
         break;
@@ -267,24 +273,7 @@ check_softbits(srsran_enb_dl_t* enb_dl, srsran_ue_dl_t* ue_dl, srsran_ue_dl_cfg_
 {
   int ret = SRSRAN_SUCCESS;
 
-  // Scramble
-  if (ue_dl->pdsch.llr_is_8bit) {
-    srsran_sequence_pdsch_apply_c(ue_dl->pdsch.e[tb],
-                                  ue_dl->pdsch.e[tb],
-                                  rnti,
-                                  ue_dl_cfg->cfg.pdsch.grant.tb[tb].cw_idx,
-                                  2 * (sf_idx % 10),
-                                  cell.id,
-                                  ue_dl_cfg->cfg.pdsch.grant.tb[tb].nof_bits);
-  } else {
-    srsran_sequence_pdsch_apply_s(ue_dl->pdsch.e[tb],
-                                  ue_dl->pdsch.e[tb],
-                                  rnti,
-                                  ue_dl_cfg->cfg.pdsch.grant.tb[tb].cw_idx,
-                                  2 * (sf_idx % 10),
-                                  cell.id,
-                                  ue_dl_cfg->cfg.pdsch.grant.tb[tb].nof_bits);
-  }
+  // UE LLRs are already descrambled and the eNb e buffer is never scrambled in place
   int16_t* rx       = ue_dl->pdsch.e[tb];
   uint8_t* rx_bytes = ue_dl->pdsch.e[tb];
   for (int i = 0, k = 0; i < ue_dl_cfg->cfg.pdsch.grant.tb[tb].nof_bits / 8; i++) {
@@ -609,6 +598,8 @@ int main(int argc, char** argv)
     ue_dl_cfg.chest_cfg.sync_error_enable    = false;
     ue_dl_cfg.cfg.dci                        = dci_cfg;
     ue_dl_cfg.cfg.pdsch.use_tbs_index_alt    = enable_256qam;
+    ue_dl_cfg.pdcch_prune_threshold          = pdcch_prune_threshold;
+    ue_dl_cfg.pdcch_prune_audit_period       = 2;
 
     srsran_pdsch_res_t pdsch_res[SRSRAN_MAX_CODEWORDS];
     for (int i = 0; i < SRSRAN_MAX_CODEWORDS; i++) {
@@ -671,6 +662,16 @@ int main(int argc, char** argv)
 
   printf("BLER: %5.1f%%\n", (float)count_failures / (float)count_tbs * 100.0f);
 
+  // Audited searches decode the candidates discarded by the pre-screening too
+  printf("PDCCH: %d of %d candidates decoded, %d of %d audited DCI found in discarded candidates\n",
+         ue_dl->pdcch_stats.nof_decoded,
+         ue_dl->pdcch_stats.nof_candidates,
+         ue_dl->pdcch_stats.nof_missed,
+         ue_dl->pdcch_stats.nof_audit_dci);
+  if (ue_dl->pdcch_stats.nof_missed > 0) {
+    ret = SRSRAN_ERROR;
+  }
+
   if (isnormal(snr_db)) {
     printf("SNR Real: %+.2f; estimated: %+.2f\n", snr_db, snr_db_avg / nof_subframes);
   }
@@ -193,6 +193,9 @@ public:
   void set_dl_metrics(uint32_t cc_idx, const dl_metrics_t& m);
   void get_dl_metrics(dl_metrics_t::array_t& m);
 
+  void set_pdcch_metrics(uint32_t cc_idx, const pdcch_metrics_t& m);
+  void get_pdcch_metrics(pdcch_metrics_t::array_t& m);
+
   void set_ch_metrics(uint32_t cc_idx, const ch_metrics_t& m);
   void get_ch_metrics(ch_metrics_t::array_t& m);
 
@@ -362,10 +365,11 @@ private:
 
   std::mutex metrics_mutex;
 
-  ch_metrics_t::array_t   ch_metrics   = {};
-  dl_metrics_t::array_t   dl_metrics   = {};
-  ul_metrics_t::array_t   ul_metrics   = {};
-  sync_metrics_t::array_t sync_metrics = {};
+  ch_metrics_t::array_t    ch_metrics    = {};
+  dl_metrics_t::array_t    dl_metrics    = {};
+  pdcch_metrics_t::array_t pdcch_metrics = {};
+  ul_metrics_t::array_t    ul_metrics    = {};
+  sync_metrics_t::array_t  sync_metrics  = {};
 
   // MBSFN
   bool     sib13_configured = false;
@@ -144,6 +144,36 @@ private:
   uint32_t count = 0;
 };
 
+struct pdcch_metrics_t {
+  typedef std::array<pdcch_metrics_t, SRSRAN_MAX_CARRIERS> array_t;
+
+  float    candidates;    ///< Average number of decoded PDCCH candidates per subframe
+  float    missed_rate;   ///< Ratio of audited DCI that were found in candidates discarded by the pre-screening
+  uint32_t nof_audit_dci; ///< Number of DCI found in audited blind searches
+  uint32_t nof_missed;    ///< Number of them found in discarded candidates
+
+  void set(const pdcch_metrics_t& other)
+  {
+    count++;
+    PHY_METRICS_SET(candidates);
+    nof_audit_dci += other.nof_audit_dci;
+    nof_missed += other.nof_missed;
+    missed_rate = (nof_audit_dci > 0) ? (float)nof_missed / (float)nof_audit_dci : 0.0f;
+  }
+
+  void reset()
+  {
+    count         = 0;
+    candidates    = 0.0f;
+    missed_rate   = 0.0f;
+    nof_audit_dci = 0;
+    nof_missed    = 0;
+  }
+
+private:
+  uint32_t count = 0;
+};
+
 struct ul_metrics_t {
   typedef std::array<ul_metrics_t, SRSRAN_MAX_CARRIERS> array_t;
 
@@ -171,12 +201,13 @@ private:
 #undef PHY_METRICS_SET
 
 struct phy_metrics_t {
-  info_metrics_t::array_t info          = {};
-  sync_metrics_t::array_t sync          = {};
-  ch_metrics_t::array_t   ch            = {};
-  dl_metrics_t::array_t   dl            = {};
-  ul_metrics_t::array_t   ul            = {};
-  uint32_t                nof_active_cc = 0;
+  info_metrics_t::array_t  info          = {};
+  sync_metrics_t::array_t  sync          = {};
+  ch_metrics_t::array_t    ch            = {};
+  dl_metrics_t::array_t    dl            = {};
+  pdcch_metrics_t::array_t pdcch         = {};
+  ul_metrics_t::array_t    ul            = {};
+  uint32_t                 nof_active_cc = 0;
 };
 
 } // namespace srsue
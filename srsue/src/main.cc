@@ -374,6 +374,14 @@ static int parse_args(all_args_t* args, int argc, char* argv[])
      bpo::value<float>(&args->phy.snr_to_cqi_offset)->default_value(0),
      "Sets an offset in the SNR to CQI table. This is used to adjust the reported CQI.")
 
+    ("phy.pdcch_prune_threshold",
+     bpo::value<float>(&args->phy.pdcch_prune_threshold)->default_value(0.0f),
+     "Skips the PDCCH candidates which mean LLR is below this ratio of the strongest candidate (0 to disable).")
+
+    ("phy.pdcch_prune_audit_period",
+     bpo::value<uint32_t>(&args->phy.pdcch_prune_audit_period)->default_value(100),
+     "Decodes the skipped PDCCH candidates once every this number of searches for measuring missed DCI (0 to disable).")
+
     ("phy.sss_algorithm",
      bpo::value<string>(&args->phy.sss_algorithm)->default_value("full"),
      "Selects the SSS estimation algorithm.")
@@ -418,6 +426,10 @@ static int parse_args(all_args_t* args, int argc, char* argv[])
      bpo::value<int>(&args->phy.force_N_id_2)->default_value(-1),
      "Force using a specific PSS (set to -1 to allow all PSSs).")
 
+    ("phy.cell_search_prescan",
+     bpo::value<bool>(&args->phy.cell_search_prescan)->default_value(true),
+     "Correlate the three PSSs at once before the cell search and only search the ones present.")
+
     // PHY NR args
     ("phy.nr.store_pdsch_ko",
       bpo::value<bool>(&args->phy.nr_store_pdsch_ko)->default_value(false),
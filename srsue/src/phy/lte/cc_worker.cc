@@ -252,6 +252,16 @@ bool cc_worker::work_dl_regular()
     }
   }
 
+  // PDCCH blind search metrics
+  if (ue_dl.pdcch_stats.nof_searches > 0) {
+    pdcch_metrics_t pdcch_metrics = {};
+    pdcch_metrics.candidates      = ue_dl.pdcch_stats.nof_decoded;
+    pdcch_metrics.nof_audit_dci   = ue_dl.pdcch_stats.nof_audit_dci;
+    pdcch_metrics.nof_missed      = ue_dl.pdcch_stats.nof_missed;
+    phy->set_pdcch_metrics(cc_idx, pdcch_metrics);
+    ue_dl.pdcch_stats = {};
+  }
+
   srsran_dci_dl_t dci_dl       = {};
   uint32_t        grant_cc_idx = 0;
   bool            has_dl_grant = phy->get_dl_pending_grant(CURRENT_TTI, cc_idx, &grant_cc_idx, &dci_dl);
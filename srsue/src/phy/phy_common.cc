@@ -69,7 +69,9 @@ void phy_common::init(phy_args_t*                  _args,
 
 void phy_common::set_ue_dl_cfg(srsran_ue_dl_cfg_t* ue_dl_cfg)
 {
-  ue_dl_cfg->snr_to_cqi_offset = args->snr_to_cqi_offset;
+  ue_dl_cfg->snr_to_cqi_offset        = args->snr_to_cqi_offset;
+  ue_dl_cfg->pdcch_prune_threshold    = args->pdcch_prune_threshold;
+  ue_dl_cfg->pdcch_prune_audit_period = args->pdcch_prune_audit_period;
 
   srsran_chest_dl_cfg_t* chest_cfg = &ue_dl_cfg->chest_cfg;
 
@@ -837,6 +839,22 @@ void phy_common::get_dl_metrics(dl_metrics_t::array_t& m)
   }
 }
 
+void phy_common::set_pdcch_metrics(uint32_t cc_idx, const pdcch_metrics_t& m)
+{
+  std::unique_lock<std::mutex> lock(metrics_mutex);
+  pdcch_metrics[cc_idx].set(m);
+}
+
+void phy_common::get_pdcch_metrics(pdcch_metrics_t::array_t& m)
+{
+  std::unique_lock<std::mutex> lock(metrics_mutex);
+
+  for (uint32_t i = 0; i < args->nof_lte_carriers; i++) {
+    m[i] = pdcch_metrics[i];
+    pdcch_metrics[i].reset();
+  }
+}
+
 void phy_common::set_ch_metrics(uint32_t cc_idx, const ch_metrics_t& m)
 {
   std::unique_lock<std::mutex> lock(metrics_mutex);
@@ -55,7 +55,11 @@ search::~search()
   srsran_ue_cellsearch_free(&cs);
 }
 
-void search::init(srsran::rf_buffer_t& buffer_, uint32_t nof_rx_channels, search_callback* parent, int force_N_id_2_)
+void search::init(srsran::rf_buffer_t& buffer_,
+                  uint32_t             nof_rx_channels,
+                  search_callback*     parent,
+                  int                  force_N_id_2_,
+                  bool                 prescan_en)
 {
   p = parent;
 
@@ -65,6 +69,9 @@ void search::init(srsran::rf_buffer_t& buffer_, uint32_t nof_rx_channels, search
     Error("SYNC:  Initiating UE cell search");
   }
   srsran_ue_cellsearch_set_nof_valid_frames(&cs, 4);
+  if (srsran_ue_cellsearch_set_prescan(&cs, prescan_en, SRSRAN_CS_PRESCAN_DEFAULT_THRESHOLD)) {
+    Error("SYNC:  Initiating UE cell search pre-scan");
+  }
 
   if (srsran_ue_mib_sync_init_multi(&ue_mib_sync, radio_recv_callback, nof_rx_channels, parent)) {
     Error("SYNC:  Initiating UE MIB synchronization");